@@ -0,0 +1,310 @@
+package sciter
+
+/*
+#include "sciter-x.h"
+
+extern UINT_PTR SCAPI SciterPostCallback (HWINDOW hwnd, UINT_PTR wparam, UINT_PTR lparam, UINT timeoutms);
+*/
+import "C"
+import (
+	"errors"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+)
+
+// AsyncDispatcher runs the event callbacks that need no answer on a pool of
+// goroutines instead of the UI thread, so that a slow handler (e.g. a
+// database lookup on click) does not stall rendering.
+//
+// Set it as EventHandler.Async: OnBehaviorEvent, OnDataArrived and OnTimer
+// are then called on a worker with a private copy of the event, while the UI
+// thread answers right away as if the event was not handled; timers are one
+// shot. The workers must not touch the DOM, which belongs to the UI thread:
+// they hand their results over with Post.
+//
+// Events travel through a lock-free ring buffer filled by the UI thread; when
+// it is full, or the dispatcher is closed, events are handled synchronously.
+type AsyncDispatcher struct {
+	s    *Sciter
+	ring []asyncSlot
+	mask uintptr
+	// next position to fill, UI thread only
+	head uintptr
+	// next position to take, shared by the workers
+	tail uintptr
+
+	// one token per queued event at most, so that no wakeup is lost
+	wake   chan struct{}
+	closed chan struct{}
+	once   sync.Once
+	wg     sync.WaitGroup
+	// dispatch calls between their closed check and their publish, see Close
+	filling int32
+}
+
+// asyncSlot is a ring cell: seq tells whether it is free for the position
+// being filled (seq == pos) or holds the event of the position (seq == pos+1)
+type asyncSlot struct {
+	seq uintptr
+	ev  asyncEvent
+}
+
+// asyncEvent is a copy of an event and of everything it refers to
+type asyncEvent struct {
+	handler *EventHandler
+	el      *Element
+	evtg    uint
+
+	behavior BehaviorEventParams
+	arrived  DataArrivedParams
+	timer    TimerParams
+
+	// keep the elements and buffers the copied params point to
+	refs  [2]*Element
+	name  []uint16
+	uri   []uint16
+	bytes []byte
+}
+
+var (
+	errAsyncClosed = errors.New("AsyncDispatcher: closed")
+	errAsyncPost   = errors.New("AsyncDispatcher: SciterPostCallback failed")
+)
+
+// NewAsyncDispatcher starts workers goroutines (runtime.NumCPU() if <= 0)
+// for the handlers of the window s, with a queue of at least queueSize events.
+// It must be called from the UI thread.
+func NewAsyncDispatcher(s *Sciter, workers, queueSize int) *AsyncDispatcher {
+	// posted functions arrive through the host callback
+	if len(s.callbacks) == 0 {
+		s.SetCallback(&CallbackHandler{})
+	}
+	d := newAsyncDispatcher(workers, queueSize)
+	d.s = s
+	return d
+}
+
+func newAsyncDispatcher(workers, queueSize int) *AsyncDispatcher {
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+	size := 64
+	for size < queueSize {
+		size *= 2
+	}
+	d := &AsyncDispatcher{
+		ring:   make([]asyncSlot, size),
+		mask:   uintptr(size - 1),
+		wake:   make(chan struct{}, size),
+		closed: make(chan struct{}),
+	}
+	for i := range d.ring {
+		d.ring[i].seq = uintptr(i)
+	}
+	d.wg.Add(workers)
+	for i := 0; i < workers; i++ {
+		go d.work()
+	}
+	return d
+}
+
+// Close stops the workers once the queued events are handled. An event
+// queued while the workers were stopping is handled by Close itself.
+func (d *AsyncDispatcher) Close() {
+	d.once.Do(func() {
+		close(d.closed)
+	})
+	// no event is published after this, the last ones may have come too late
+	// for the workers
+	for atomic.LoadInt32(&d.filling) != 0 {
+		runtime.Gosched()
+	}
+	d.wg.Wait()
+	var ev asyncEvent
+	for d.take(&ev) {
+		ev.run()
+	}
+}
+
+// hasAsyncCallback reports whether the handler has a callback for the event
+// group that may run on an AsyncDispatcher
+func (h *EventHandler) hasAsyncCallback(evtg uint) bool {
+	switch evtg {
+	case HANDLE_BEHAVIOR_EVENT:
+		return h.OnBehaviorEvent != nil
+	case HANDLE_DATA_ARRIVED:
+		return h.OnDataArrived != nil
+	case HANDLE_TIMER:
+		return h.OnTimer != nil
+	}
+	return false
+}
+
+// dispatch queues an event for the workers, false if it has to be handled synchronously
+func (d *AsyncDispatcher) dispatch(handler *EventHandler, he C.HELEMENT, evtg uint, params unsafe.Pointer) bool {
+	// held up to the publish, so that Close cannot finish in between
+	atomic.AddInt32(&d.filling, 1)
+	defer atomic.AddInt32(&d.filling, -1)
+	select {
+	case <-d.closed:
+		return false
+	default:
+	}
+	pos := d.head
+	slot := &d.ring[pos&d.mask]
+	if atomic.LoadUintptr(&slot.seq) != pos {
+		// full
+		return false
+	}
+	ev := &slot.ev
+	ev.handler = handler
+	if he != nil {
+		ev.el = WrapElement(he)
+	}
+	ev.evtg = evtg
+	switch evtg {
+	case HANDLE_BEHAVIOR_EVENT:
+		p := (*BehaviorEventParams)(params)
+		ev.behavior = *p
+		ev.refs[0] = WrapElement(p.heTarget)
+		ev.refs[1] = WrapElement(p.he)
+		if p.name != nil {
+			ev.name = appendCString(nil, (*uint16)(unsafe.Pointer(p.name)))
+			ev.behavior.name = (*C.WCHAR)(unsafe.Pointer(&ev.name[0]))
+		}
+		// the data gets its own reference
+		data := (*Value)(unsafe.Pointer(&ev.behavior.data))
+		data.init()
+		data.Copy((*Value)(unsafe.Pointer(&p.data)))
+	case HANDLE_DATA_ARRIVED:
+		p := (*DataArrivedParams)(params)
+		ev.arrived = *p
+		ev.refs[0] = WrapElement(p.initiator)
+		ev.bytes = append([]byte(nil), p.DataView()...)
+		ev.arrived.data = nil
+		if len(ev.bytes) > 0 {
+			ev.arrived.data = (*C.BYTE)(unsafe.Pointer(&ev.bytes[0]))
+		}
+		if p.uri != nil {
+			ev.uri = appendCString(nil, (*uint16)(unsafe.Pointer(p.uri)))
+			ev.arrived.uri = (*C.WCHAR)(unsafe.Pointer(&ev.uri[0]))
+		}
+	case HANDLE_TIMER:
+		ev.timer = *(*TimerParams)(params)
+	}
+	// publish the event to the workers
+	atomic.StoreUintptr(&slot.seq, pos+1)
+	d.head = pos + 1
+	d.wake <- struct{}{}
+	return true
+}
+
+// take removes the oldest event from the ring, false if it is empty
+func (d *AsyncDispatcher) take(ev *asyncEvent) bool {
+	for {
+		pos := atomic.LoadUintptr(&d.tail)
+		slot := &d.ring[pos&d.mask]
+		seq := atomic.LoadUintptr(&slot.seq)
+		switch diff := int(seq - (pos + 1)); {
+		case diff < 0:
+			return false
+		case diff == 0 && atomic.CompareAndSwapUintptr(&d.tail, pos, pos+1):
+			// the copy owns the event now, the buffers included
+			*ev = slot.ev
+			slot.ev = asyncEvent{}
+			// the cell is free for the position one lap later
+			atomic.StoreUintptr(&slot.seq, pos+d.mask+1)
+			return true
+		}
+		// another worker took it first
+	}
+}
+
+func (d *AsyncDispatcher) work() {
+	defer d.wg.Done()
+	var ev asyncEvent
+	for {
+		select {
+		case <-d.wake:
+		case <-d.closed:
+			// drain what is left
+			for d.take(&ev) {
+				ev.run()
+			}
+			return
+		}
+		if d.take(&ev) {
+			ev.run()
+		}
+	}
+}
+
+// appendCString appends the NUL terminated utf-16 string s, NUL included
+func appendCString(dst []uint16, s *uint16) []uint16 {
+	return append(dst, utf16Slice(s, utf16Len(s)+1)...)
+}
+
+func (ev *asyncEvent) run() {
+	h := ev.handler
+	// the callbacks were checked by dispatch, but may have been cleared since
+	switch ev.evtg {
+	case HANDLE_BEHAVIOR_EVENT:
+		if h.OnBehaviorEvent != nil {
+			h.OnBehaviorEvent(ev.el, &ev.behavior)
+		}
+		(*Value)(unsafe.Pointer(&ev.behavior.data)).clear()
+	case HANDLE_DATA_ARRIVED:
+		if h.OnDataArrived != nil {
+			h.OnDataArrived(ev.el, &ev.arrived)
+		}
+	case HANDLE_TIMER:
+		if h.OnTimer != nil {
+			h.OnTimer(ev.el, &ev.timer)
+		}
+	}
+	*ev = asyncEvent{}
+}
+
+// posted functions, by the handle passed as SciterPostCallback lparam
+var postedFuncs handleTable
+
+// wparam of the SC_POSTED_NOTIFICATION carrying a posted function
+const postedFuncTag = 0x676f5046
+
+// Post runs fn on the UI thread of the dispatcher's window, it may be called from any goroutine
+func (d *AsyncDispatcher) Post(fn func()) error {
+	h := postedFuncs.add(fn)
+	select {
+	case <-d.closed:
+		takePostedFunc(h)
+		return errAsyncClosed
+	default:
+	}
+	// cgo call, 0: no waiting for the UI thread
+	if C.SciterPostCallback(d.s.hwnd, postedFuncTag, C.UINT_PTR(h), 0) == 0 {
+		// e.g. the window is gone, fn would never run
+		takePostedFunc(h)
+		return errAsyncPost
+	}
+	return nil
+}
+
+func takePostedFunc(h uintptr) func() {
+	if fn := postedFuncs.remove(h); fn != nil {
+		return fn.(func())
+	}
+	return nil
+}
+
+// runPostedNotification runs the function carried by a posted notification, false if it carries none
+func runPostedNotification(p *ScnPostedNotification) bool {
+	if uintptr(unsafe.Pointer(p.Wparam)) != postedFuncTag {
+		return false
+	}
+	if fn := takePostedFunc(uintptr(unsafe.Pointer(p.Lparam))); fn != nil {
+		fn()
+	}
+	return true
+}
@@ -0,0 +1,104 @@
+package sciter
+
+import (
+	"sort"
+	"sync/atomic"
+	"testing"
+	"time"
+	"unsafe"
+)
+
+// simulated handler work, e.g. a database lookup
+const benchHandlerWork = 20 * time.Microsecond
+
+func spin(d time.Duration) {
+	for start := time.Now(); time.Since(start) < d; {
+	}
+}
+
+// benchmarkTurnaround measures how long the UI thread is held by an event,
+// from the engine calling goElementEventProc to it returning
+func benchmarkTurnaround(b *testing.B, async *AsyncDispatcher) {
+	handler := &EventHandler{
+		OnTimer: func(he *Element, params *TimerParams) bool {
+			spin(benchHandlerWork)
+			return false
+		},
+		Async: async,
+	}
+	tag := registerEventHandler(handler, false)
+	defer releaseEventHandler(tag)
+	var params TimerParams
+	turnaround := make([]time.Duration, b.N)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		start := time.Now()
+		goElementEventProc(tag, nil, HANDLE_TIMER, unsafe.Pointer(&params), 0)
+		turnaround[i] = time.Since(start)
+		// the rest of the frame, which leaves the workers time to keep up
+		spin(benchHandlerWork / 2)
+	}
+	b.StopTimer()
+	if async != nil {
+		async.Close()
+	}
+	sort.Slice(turnaround, func(i, j int) bool {
+		return turnaround[i] < turnaround[j]
+	})
+	percentile := func(p int) float64 {
+		return float64(turnaround[(len(turnaround)-1)*p/100].Nanoseconds())
+	}
+	b.Logf("turnaround p50 %.0fns p99 %.0fns max %.0fns", percentile(50), percentile(99), percentile(100))
+}
+
+func BenchmarkTurnaroundSync(b *testing.B) {
+	benchmarkTurnaround(b, nil)
+}
+
+func BenchmarkTurnaroundAsync(b *testing.B) {
+	benchmarkTurnaround(b, newAsyncDispatcher(4, 1024))
+}
+
+func TestAsyncDispatchSkipsMissingCallback(t *testing.T) {
+	d := newAsyncDispatcher(1, 0)
+	defer d.Close()
+	// Coalesce subscribes to HANDLE_TIMER whether there is an OnTimer or not
+	handler := &EventHandler{Async: d}
+	tag := registerEventHandler(handler, false)
+	defer releaseEventHandler(tag)
+	var params TimerParams
+	goElementEventProc(tag, nil, HANDLE_TIMER, unsafe.Pointer(&params), 0)
+	if d.head != 0 {
+		t.Fatal("event without callback queued")
+	}
+}
+
+func TestAsyncCloseRunsQueuedEvents(t *testing.T) {
+	for round := 0; round < 50; round++ {
+		var ran int32
+		handler := &EventHandler{
+			OnTimer: func(he *Element, params *TimerParams) bool {
+				atomic.AddInt32(&ran, 1)
+				return false
+			},
+		}
+		d := newAsyncDispatcher(2, 64)
+		var params TimerParams
+		queued := make(chan int32)
+		go func() {
+			var n int32
+			for i := 0; i < 1000; i++ {
+				if d.dispatch(handler, nil, HANDLE_TIMER, unsafe.Pointer(&params)) {
+					n++
+				}
+			}
+			queued <- n
+		}()
+		d.Close()
+		n := <-queued
+		// dispatch after Close fails, so everything queued has run by now
+		if got := atomic.LoadInt32(&ran); got != n {
+			t.Fatalf("round %d: %d events queued, %d ran", round, n, got)
+		}
+	}
+}
@@ -1,65 +1,286 @@
-#include "sciter-x.h"
-#include "_cgo_export.h"
-
-// typedef SBOOL SC_CALLBACK SciterElementCallback(HELEMENT he, LPVOID param);
-
-SBOOL SC_CALLBACK SciterElementCallback_cgo(HELEMENT he, LPVOID param)
-{
-    return goSciterElementCallback(he, param);
-}
-
-// typedef VOID SC_CALLBACK LPCBYTE_RECEIVER(LPCBYTE bytes, UINT num_bytes, LPVOID param);
-VOID SC_CALLBACK LPCBYTE_RECEIVER_cgo(LPCBYTE bytes, UINT num_bytes, LPVOID param)
-{
-    goLPCBYTE_RECEIVER((BYTE*)bytes, num_bytes, param);
-}
-
-// typedef VOID SC_CALLBACK LPCWSTR_RECEIVER(LPCWSTR str, UINT str_length, LPVOID param);
-VOID SC_CALLBACK LPCWSTR_RECEIVER_cgo(LPCWSTR str, UINT str_length, LPVOID param)
-{
-    goLPCWSTR_RECEIVER((WCHAR*)str, str_length, param);
-}
-
-// typedef VOID SC_CALLBACK LPCSTR_RECEIVER(LPCSTR str, UINT str_length, LPVOID param);
-VOID SC_CALLBACK LPCSTR_RECEIVER_cgo(LPCSTR str, UINT str_length, LPVOID param)
-{
-    goLPCSTR_RECEIVER(str, str_length, param);
-}
-
-// typedef SBOOL SC_CALLBACK ElementEventProc(LPVOID tag, HELEMENT he, UINT evtg, LPVOID prms);
-SBOOL SC_CALLBACK ElementEventProc_cgo(LPVOID tag, HELEMENT he, UINT evtg, LPVOID prms)
-{
-    return goElementEventProc(tag, he, evtg, prms);
-}
-
-// typedef UINT SC_CALLBACK SciterHostCallback(LPSCITER_CALLBACK_NOTIFICATION pns, LPVOID callbackParam);
-UINT SC_CALLBACK SciterHostCallback_cgo(LPSCITER_CALLBACK_NOTIFICATION pns, LPVOID callbackParam)
-{
-    return goSciterHostCallback(pns, callbackParam);
-}
-
-// typedef VOID NATIVE_FUNCTOR_INVOKE(VOID* tag, UINT argc, const VALUE* argv, VALUE* retval); // retval may contain error definition
-VOID NATIVE_FUNCTOR_INVOKE_cgo(VOID* tag, UINT argc, const VALUE* argv, VALUE* retval)
-{
-    goNATIVE_FUNCTOR_INVOKE(tag, argc, (VALUE*)argv, retval);
-}
-
-// typedef VOID NATIVE_FUNCTOR_RELEASE(VOID* tag);
-VOID NATIVE_FUNCTOR_RELEASE_cgo(VOID* tag)
-{
-    goNATIVE_FUNCTOR_RELEASE(tag);
-}
-
-// typedef INT SC_CALLBACK ELEMENT_COMPARATOR(HELEMENT he1, HELEMENT he2, LPVOID param);
-
-INT SC_CALLBACK ELEMENT_COMPARATOR_cgo(HELEMENT he1, HELEMENT he2, LPVOID param)
-{
-    return goELEMENT_COMPARATOR(he1, he2, param);
-}
-
-// typedef SBOOL SC_CALLBACK KeyValueCallback(LPVOID param, const VALUE* pkey, const VALUE* pval);
-
-SBOOL SC_CALLBACK KeyValueCallback_cgo(LPVOID param, const VALUE* pkey, const VALUE* pval)
-{
-    return goKeyValueCallback(param, (VALUE*)pkey, (VALUE*)pval);
+#include "sciter-x.h"
+#include "_cgo_export.h"
+
+// typedef SBOOL SC_CALLBACK SciterElementCallback(HELEMENT he, LPVOID param);
+
+SBOOL SC_CALLBACK SciterElementCallback_cgo(HELEMENT he, LPVOID param)
+{
+    return goSciterElementCallback(he, (UINT_PTR)param);
+}
+
+// ctx is a handle of the go select context table, not a pointer
+SCDOM_RESULT SciterSelectElementsCtx(HELEMENT he, LPCWSTR CSS_selectors, UINT_PTR ctx)
+{
+    return SciterSelectElementsW(he, CSS_selectors, SciterElementCallback_cgo, (LPVOID)ctx);
+}
+
+// typedef VOID SC_CALLBACK LPCBYTE_RECEIVER(LPCBYTE bytes, UINT num_bytes, LPVOID param);
+VOID SC_CALLBACK LPCBYTE_RECEIVER_cgo(LPCBYTE bytes, UINT num_bytes, LPVOID param)
+{
+    goLPCBYTE_RECEIVER((BYTE*)bytes, num_bytes, param);
+}
+
+// param is a handle of the go byte sink table, not a pointer
+VOID SC_CALLBACK LPCBYTE_SINK_cgo(LPCBYTE bytes, UINT num_bytes, LPVOID param)
+{
+    goLPCBYTE_SINK((BYTE*)bytes, num_bytes, (UINT_PTR)param);
+}
+
+SCDOM_RESULT SciterGetElementHtmlSink(HELEMENT he, SBOOL outer, UINT_PTR sink)
+{
+    return SciterGetElementHtmlCB(he, outer, LPCBYTE_SINK_cgo, (LPVOID)sink);
+}
+
+// typedef VOID SC_CALLBACK LPCWSTR_RECEIVER(LPCWSTR str, UINT str_length, LPVOID param);
+VOID SC_CALLBACK LPCWSTR_RECEIVER_cgo(LPCWSTR str, UINT str_length, LPVOID param)
+{
+    goLPCWSTR_RECEIVER((WCHAR*)str, str_length, param);
+}
+
+// typedef VOID SC_CALLBACK LPCSTR_RECEIVER(LPCSTR str, UINT str_length, LPVOID param);
+VOID SC_CALLBACK LPCSTR_RECEIVER_cgo(LPCSTR str, UINT str_length, LPVOID param)
+{
+    goLPCSTR_RECEIVER(str, str_length, param);
+}
+
+// Coalescing of high frequency events for handlers attached with the
+// COALESCE_TAG bit set in their tag (see registerEventHandler in sciter.go).
+//
+// The first MOUSE_MOVE, scroll or size event of a kind on an element goes to
+// Go right away and opens a frame: until the frame timer fires, further events
+// of that kind only replace the pending one, which the timer then delivers
+// with the number of events it replaced. Any other event of the handler on the
+// element flushes what is pending first, so that the order is preserved.
+//
+// The frame timer needs HANDLE_TIMER, so it is added to the subscription of
+// every coalescing handler, whether it has an OnTimer or not.
+//
+// Events of a window all arrive on its UI thread, so every thread gets its own
+// table and windows running on different UI threads never share slots.
+
+#define COALESCE_TAG     ((UINT_PTR)1 << 20)
+#define COALESCE_FRAME   16
+#define COALESCE_SLOTS   64
+
+#if defined(_MSC_VER)
+#define COALESCE_THREAD  __declspec(thread)
+#else
+#define COALESCE_THREAD  __thread
+#endif
+
+typedef struct {
+    UINT_PTR tag;     // 0 for a free slot
+    HELEMENT he;
+    UINT     evtg;
+    UINT     cmd;
+    UINT     pending; // 1 when params hold an event not delivered yet,
+                      // its target and dragging elements are then referenced
+    UINT     dropped;
+    union {
+        struct MOUSE_PARAMS  mouse;
+        struct SCROLL_PARAMS scroll;
+    } params;
+} COALESCED_EVENT;
+
+static COALESCE_THREAD COALESCED_EVENT coalesced[COALESCE_SLOTS];
+
+static SBOOL coalesce_event(UINT_PTR tag, HELEMENT he, UINT evtg, LPVOID prms);
+// the frame timer id, the same on all threads
+#define COALESCE_TIMER_ID ((UINT_PTR)coalesce_event)
+
+// takes (use) or drops references on the elements a pending copy points to,
+// the events it stands for may be delivered after they are gone otherwise
+static void coalesce_refs(COALESCED_EVENT* ce, SBOOL use)
+{
+    HELEMENT hes[2] = { NULL, NULL };
+    if( ce->evtg == HANDLE_MOUSE ) {
+        hes[0] = ce->params.mouse.target;
+        hes[1] = ce->params.mouse.dragging;
+    } else if( ce->evtg == HANDLE_SCROLL )
+        hes[0] = ce->params.scroll.target;
+    for( UINT i = 0; i < 2; ++i ) {
+        if( !hes[i] )
+            continue;
+        if( use )
+            Sciter_UseElement(hes[i]);
+        else
+            Sciter_UnuseElement(hes[i]);
+    }
+}
+
+static SBOOL coalesce_deliver(COALESCED_EVENT* ce)
+{
+    // the handler may cause events that land in the same slot
+    COALESCED_EVENT e = *ce;
+    ce->pending = 0;
+    ce->dropped = 0;
+    SBOOL r = goElementEventProc(e.tag, e.he, e.evtg, e.evtg == HANDLE_SIZE ? NULL : &e.params, e.dropped);
+    // the references taken when the copy was stored
+    coalesce_refs(&e, FALSE);
+    return r;
+}
+
+// delivers the pending events of tag (any tag if 0) on he, frees the idle slots
+// if release, returns whether events are still expected in the frame
+static SBOOL coalesce_flush(UINT_PTR tag, HELEMENT he, SBOOL release)
+{
+    SBOOL busy = FALSE;
+    for( UINT i = 0; i < COALESCE_SLOTS; ++i ) {
+        COALESCED_EVENT* ce = &coalesced[i];
+        if( !ce->tag || ce->he != he || (tag && ce->tag != tag) )
+            continue;
+        if( ce->pending ) {
+            coalesce_deliver(ce);
+            busy = TRUE;
+        } else if( release )
+            ce->tag = 0;
+        else
+            busy = TRUE;
+    }
+    return busy;
+}
+
+static SBOOL coalescible(UINT evtg, LPVOID prms, UINT* pcmd)
+{
+    switch( evtg ) {
+        case HANDLE_MOUSE:
+            *pcmd = ((struct MOUSE_PARAMS*)prms)->cmd;
+            return (*pcmd & 0xFF) == MOUSE_MOVE;
+        case HANDLE_SCROLL:
+            *pcmd = ((struct SCROLL_PARAMS*)prms)->cmd;
+            return TRUE;
+        case HANDLE_SIZE:
+            *pcmd = 0;
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static SBOOL coalesce_event(UINT_PTR tag, HELEMENT he, UINT evtg, LPVOID prms)
+{
+    UINT cmd = 0;
+    if( evtg == SUBSCRIPTIONS_REQUEST ) {
+        SBOOL r = goElementEventProc(tag, he, evtg, prms, 0);
+        *(UINT*)prms |= HANDLE_TIMER;
+        return r;
+    }
+    if( evtg == HANDLE_TIMER && ((struct TIMER_PARAMS*)prms)->timerId == COALESCE_TIMER_ID )
+        // end of the frame, TRUE keeps the timer ticking while events keep coming
+        return coalesce_flush(0, he, TRUE);
+    if( !coalescible(evtg, prms, &cmd) ) {
+        coalesce_flush(tag, he, FALSE);
+        if( evtg == HANDLE_INITIALIZATION && ((struct INITIALIZATION_PARAMS*)prms)->cmd == BEHAVIOR_DETACH )
+            for( UINT i = 0; i < COALESCE_SLOTS; ++i ) {
+                COALESCED_EVENT* ce = &coalesced[i];
+                if( ce->tag != tag || ce->he != he )
+                    continue;
+                // queued again by the flush above
+                if( ce->pending )
+                    coalesce_refs(ce, FALSE);
+                ce->pending = 0;
+                ce->tag = 0;
+            }
+        return goElementEventProc(tag, he, evtg, prms, 0);
+    }
+
+    UINT h = (UINT)((((UINT_PTR)he >> 4) ^ tag ^ (evtg << 8) ^ cmd) % COALESCE_SLOTS);
+    COALESCED_EVENT* slot = NULL;
+    for( UINT n = 0; n < COALESCE_SLOTS; ++n ) {
+        COALESCED_EVENT* ce = &coalesced[(h + n) % COALESCE_SLOTS];
+        if( ce->tag == tag && ce->he == he && ce->evtg == evtg && ce->cmd == cmd ) {
+            // within a frame: keep the latest only
+            if( ce->pending ) {
+                ++ce->dropped;
+                coalesce_refs(ce, FALSE);
+            }
+            ce->pending = 1;
+            if( evtg == HANDLE_MOUSE )
+                ce->params.mouse = *(struct MOUSE_PARAMS*)prms;
+            else if( evtg == HANDLE_SCROLL )
+                ce->params.scroll = *(struct SCROLL_PARAMS*)prms;
+            coalesce_refs(ce, TRUE);
+            return FALSE;
+        }
+        if( !ce->tag && !slot )
+            slot = ce;
+    }
+    if( slot ) {
+        // first of a frame: deliver now and open the frame
+        slot->tag = tag;
+        slot->he = he;
+        slot->evtg = evtg;
+        slot->cmd = cmd;
+        slot->pending = 0;
+        slot->dropped = 0;
+        SciterSetTimer(he, COALESCE_FRAME, COALESCE_TIMER_ID);
+    }
+    // no free slot: no coalescing either
+    return goElementEventProc(tag, he, evtg, prms, 0);
+}
+
+// typedef SBOOL SC_CALLBACK ElementEventProc(LPVOID tag, HELEMENT he, UINT evtg, LPVOID prms);
+SBOOL SC_CALLBACK ElementEventProc_cgo(LPVOID tag, HELEMENT he, UINT evtg, LPVOID prms)
+{
+    if( (UINT_PTR)tag & COALESCE_TAG )
+        return coalesce_event((UINT_PTR)tag, he, evtg, prms);
+    return goElementEventProc((UINT_PTR)tag, he, evtg, prms, 0);
+}
+
+// tag is a handle of the go event handler table, not a pointer
+SCDOM_RESULT SciterAttachEventHandlerTag(HELEMENT he, UINT_PTR tag)
+{
+    return SciterAttachEventHandler(he, ElementEventProc_cgo, (LPVOID)tag);
+}
+
+SCDOM_RESULT SciterDetachEventHandlerTag(HELEMENT he, UINT_PTR tag)
+{
+    return SciterDetachEventHandler(he, ElementEventProc_cgo, (LPVOID)tag);
+}
+
+SCDOM_RESULT SciterWindowAttachEventHandlerTag(HWINDOW hwnd, UINT_PTR tag, UINT subscription)
+{
+    return SciterWindowAttachEventHandler(hwnd, ElementEventProc_cgo, (LPVOID)tag, subscription);
+}
+
+SCDOM_RESULT SciterWindowDetachEventHandlerTag(HWINDOW hwnd, UINT_PTR tag)
+{
+    return SciterWindowDetachEventHandler(hwnd, ElementEventProc_cgo, (LPVOID)tag);
+}
+
+// typedef UINT SC_CALLBACK SciterHostCallback(LPSCITER_CALLBACK_NOTIFICATION pns, LPVOID callbackParam);
+UINT SC_CALLBACK SciterHostCallback_cgo(LPSCITER_CALLBACK_NOTIFICATION pns, LPVOID callbackParam)
+{
+    return goSciterHostCallback(pns, callbackParam);
+}
+
+// typedef VOID NATIVE_FUNCTOR_INVOKE(VOID* tag, UINT argc, const VALUE* argv, VALUE* retval); // retval may contain error definition
+VOID NATIVE_FUNCTOR_INVOKE_cgo(VOID* tag, UINT argc, const VALUE* argv, VALUE* retval)
+{
+    goNATIVE_FUNCTOR_INVOKE((UINT_PTR)tag, argc, (VALUE*)argv, retval);
+}
+
+// typedef VOID NATIVE_FUNCTOR_RELEASE(VOID* tag);
+VOID NATIVE_FUNCTOR_RELEASE_cgo(VOID* tag)
+{
+    goNATIVE_FUNCTOR_RELEASE((UINT_PTR)tag);
+}
+
+// the tag is a handle of the go functor table, not a pointer
+UINT ValueNativeFunctorSetHandle(VALUE* pval, UINT_PTR handle)
+{
+    return ValueNativeFunctorSet(pval, NATIVE_FUNCTOR_INVOKE_cgo, NATIVE_FUNCTOR_RELEASE_cgo, (VOID*)handle);
+}
+
+// typedef INT SC_CALLBACK ELEMENT_COMPARATOR(HELEMENT he1, HELEMENT he2, LPVOID param);
+
+INT SC_CALLBACK ELEMENT_COMPARATOR_cgo(HELEMENT he1, HELEMENT he2, LPVOID param)
+{
+    return goELEMENT_COMPARATOR(he1, he2, param);
+}
+
+// typedef SBOOL SC_CALLBACK KeyValueCallback(LPVOID param, const VALUE* pkey, const VALUE* pval);
+
+SBOOL SC_CALLBACK KeyValueCallback_cgo(LPVOID param, const VALUE* pkey, const VALUE* pval)
+{
+    return goKeyValueCallback(param, (VALUE*)pkey, (VALUE*)pval);
 }
\ No newline at end of file
@@ -0,0 +1,806 @@
+package sciter
+
+/*
+#include "sciter-x.h"
+*/
+import "C"
+import (
+	"fmt"
+	"math"
+	"reflect"
+	"strings"
+	"sync"
+	"unsafe"
+)
+
+// Marshal converts a go value to a sciter Value.
+//
+// Structs become maps keyed by field name, or by the name given in a
+// `sciter:"name"` tag; `sciter:"-"` skips a field and `sciter:",omitempty"`
+// leaves out zero values. Slices and arrays become arrays ([]byte becomes
+// T_BYTES), maps become maps; nil pointers, slices, maps and interfaces become null.
+// *Value, NativeFunctor and NativeFunc are stored as they are.
+//
+// The conversion plan of every type is compiled once and cached, struct keys
+// are interned (see InternKey) and shared by all later calls.
+func Marshal(val interface{}) (*Value, error) {
+	v := NewValue()
+	if val == nil {
+		v.t = T_NULL
+		return v, nil
+	}
+	rv := reflect.ValueOf(val)
+	if err := typeEncoder(rv.Type())(v, rv); err != nil {
+		return nil, err
+	}
+	return v, nil
+}
+
+// Unmarshal stores the content of a sciter Value into the go value pointed to by dst,
+// following the same rules as Marshal. Map keys missing from the Value leave
+// struct fields untouched, undefined and null values leave the target zeroed.
+// An empty interface receives bool, int, float64, string, []byte,
+// []interface{}, map[string]interface{} or, for anything else, a *Value.
+func Unmarshal(val *Value, dst interface{}) error {
+	rv := reflect.ValueOf(dst)
+	if rv.Kind() != reflect.Ptr || rv.IsNil() {
+		return newValueError(HV_BAD_PARAMETER, fmt.Sprintf("Unmarshal: non-pointer or nil %T", dst))
+	}
+	return typeDecoder(rv.Type().Elem())(val, rv.Elem())
+}
+
+var errorType = reflect.TypeOf((*error)(nil)).Elem()
+
+// TypedFunc adapts a go function with typed parameters, e.g. func(int, string) (float64, error),
+// to a NativeFunc. Arguments are converted following the Unmarshal rules, missing
+// ones read as zero values; the first result is converted following the Marshal rules.
+// A non-nil trailing error result is returned to script as an error string.
+//
+// The unnamed signatures listed in typedFastFunc are called directly and allocate
+// nothing per call but the strings read from arguments. Any other signature is
+// called through reflection, which allocates its arguments and results on every
+// call; its per-type conversion plans are still compiled here, once.
+func TypedFunc(fn interface{}) (NativeFunc, error) {
+	if f := typedFastFunc(fn); f != nil {
+		return f, nil
+	}
+	fv := reflect.ValueOf(fn)
+	ft := fv.Type()
+	if ft.Kind() != reflect.Func || ft.IsVariadic() {
+		return nil, newValueError(HV_BAD_PARAMETER, fmt.Sprintf("TypedFunc: unsupported type %T", fn))
+	}
+	decs := make([]decoderFunc, ft.NumIn())
+	for i := range decs {
+		decs[i] = typeDecoder(ft.In(i))
+	}
+	nout := ft.NumOut()
+	hasErr := nout > 0 && ft.Out(nout-1) == errorType
+	if hasErr {
+		nout--
+	}
+	if nout > 1 {
+		return nil, newValueError(HV_BAD_PARAMETER, fmt.Sprintf("TypedFunc: too many results in %T", fn))
+	}
+	var enc encoderFunc
+	if nout == 1 {
+		enc = typeEncoder(ft.Out(0))
+	}
+	return func(args []Value, retval *Value) {
+		in := make([]reflect.Value, len(decs))
+		for i, dec := range decs {
+			in[i] = reflect.New(ft.In(i)).Elem()
+			if i >= len(args) {
+				continue
+			}
+			if err := dec(&args[i], in[i]); err != nil {
+				retval.SetString(err.Error(), int(C.UT_STRING_ERROR))
+				return
+			}
+		}
+		out := fv.Call(in)
+		if hasErr && !out[len(out)-1].IsNil() {
+			retval.SetString(out[len(out)-1].Interface().(error).Error(), int(C.UT_STRING_ERROR))
+			return
+		}
+		if enc != nil {
+			if err := enc(retval, out[0]); err != nil {
+				retval.clear()
+				retval.SetString(err.Error(), int(C.UT_STRING_ERROR))
+			}
+		}
+	}, nil
+}
+
+// typedFastFunc returns the NativeFunc of the common signatures, nil for the others
+func typedFastFunc(fn interface{}) NativeFunc {
+	switch f := fn.(type) {
+	case func():
+		return func(args []Value, retval *Value) { f() }
+	case func() error:
+		return func(args []Value, retval *Value) { setTypedError(retval, f()) }
+	case func() bool:
+		return func(args []Value, retval *Value) { retval.SetBool(f()) }
+	case func() int:
+		return func(args []Value, retval *Value) { setTypedError(retval, setInt64(retval, int64(f()))) }
+	case func() float64:
+		return func(args []Value, retval *Value) { retval.SetFloat(f()) }
+	case func() string:
+		return func(args []Value, retval *Value) { retval.SetString(f()) }
+	case func(bool):
+		return func(args []Value, retval *Value) { f(typedBool(args, 0)) }
+	case func(int):
+		return func(args []Value, retval *Value) { f(typedInt(args, 0)) }
+	case func(int) int:
+		return func(args []Value, retval *Value) {
+			setTypedError(retval, setInt64(retval, int64(f(typedInt(args, 0)))))
+		}
+	case func(int, int) int:
+		return func(args []Value, retval *Value) {
+			setTypedError(retval, setInt64(retval, int64(f(typedInt(args, 0), typedInt(args, 1)))))
+		}
+	case func(float64) float64:
+		return func(args []Value, retval *Value) { retval.SetFloat(f(typedFloat(args, 0))) }
+	case func(float64, float64) float64:
+		return func(args []Value, retval *Value) { retval.SetFloat(f(typedFloat(args, 0), typedFloat(args, 1))) }
+	case func(string):
+		return func(args []Value, retval *Value) { f(typedString(args, 0)) }
+	case func(string) error:
+		return func(args []Value, retval *Value) { setTypedError(retval, f(typedString(args, 0))) }
+	case func(string) string:
+		return func(args []Value, retval *Value) { retval.SetString(f(typedString(args, 0))) }
+	case func(string) (string, error):
+		return func(args []Value, retval *Value) {
+			s, err := f(typedString(args, 0))
+			if err != nil {
+				setTypedError(retval, err)
+				return
+			}
+			retval.SetString(s)
+		}
+	}
+	return nil
+}
+
+// the argument readers of the fast paths, they follow the decoders of newTypeDecoder
+
+func typedBool(args []Value, i int) bool {
+	if i >= len(args) {
+		return false
+	}
+	return args[i].Bool()
+}
+
+func typedInt(args []Value, i int) int {
+	if i >= len(args) {
+		return 0
+	}
+	if args[i].IsFloat() {
+		return int(args[i].Float())
+	}
+	return args[i].Int()
+}
+
+func typedFloat(args []Value, i int) float64 {
+	if i >= len(args) {
+		return 0
+	}
+	if args[i].IsInt() {
+		return float64(args[i].Int())
+	}
+	return args[i].Float()
+}
+
+func typedString(args []Value, i int) string {
+	if i >= len(args) {
+		return ""
+	}
+	return args[i].String()
+}
+
+func setTypedError(retval *Value, err error) {
+	if err != nil {
+		retval.SetString(err.Error(), int(C.UT_STRING_ERROR))
+	}
+}
+
+// largest magnitude up to which float64 holds every integer
+const maxExactInt = 1 << 53
+
+// setInt64 stores i as T_INT when it fits its 32 bits and as T_FLOAT beyond,
+// as ReadJSON does: the engine has no 64-bit integer type (ValueInt64DataSet
+// takes T_DATE and T_CURRENCY only). Integers a float64 cannot hold exactly
+// are an error rather than silently rounded.
+func setInt64(dst *Value, i int64) error {
+	switch {
+	case i >= math.MinInt32 && i <= math.MaxInt32:
+		return dst.SetInt(int(i))
+	case i >= -maxExactInt && i <= maxExactInt:
+		return dst.SetFloat(float64(i))
+	}
+	return errIntRange(i)
+}
+
+func errIntRange(i interface{}) error {
+	return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("Marshal: %d is out of the range of sciter numbers", i))
+}
+
+type encoderFunc func(dst *Value, rv reflect.Value) error
+type decoderFunc func(src *Value, rv reflect.Value) error
+
+var (
+	encoderCache sync.Map // map[reflect.Type]encoderFunc
+	decoderCache sync.Map // map[reflect.Type]decoderFunc
+	fieldCache   sync.Map // map[reflect.Type][]codecField
+
+	valuePtrType     = reflect.TypeOf((*Value)(nil))
+	nativeFunctorTyp = reflect.TypeOf(NativeFunctor(nil))
+	nativeFuncType   = reflect.TypeOf(NativeFunc(nil))
+	intSliceType     = reflect.TypeOf([]int(nil))
+	floatSliceType   = reflect.TypeOf([]float64(nil))
+	stringSliceType  = reflect.TypeOf([]string(nil))
+)
+
+// the element/key/value Value the codec works on, it is never handed out
+// so it does not need a finalizer
+func newTempValue() *Value {
+	t := new(Value)
+	t.init()
+	return t
+}
+
+func unsupportedType(op string, t reflect.Type) error {
+	return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("%s: unsupported type %s", op, t))
+}
+
+// typeEncoder returns the cached encoder of t, compiling it on first use.
+// Recursive types see a forwarding stub until their own encoder is ready.
+func typeEncoder(t reflect.Type) encoderFunc {
+	if f, ok := encoderCache.Load(t); ok {
+		return f.(encoderFunc)
+	}
+	var (
+		wg sync.WaitGroup
+		f  encoderFunc
+	)
+	wg.Add(1)
+	fi, loaded := encoderCache.LoadOrStore(t, encoderFunc(func(dst *Value, rv reflect.Value) error {
+		wg.Wait()
+		return f(dst, rv)
+	}))
+	if loaded {
+		return fi.(encoderFunc)
+	}
+	f = newTypeEncoder(t)
+	wg.Done()
+	encoderCache.Store(t, f)
+	return f
+}
+
+func newTypeEncoder(t reflect.Type) encoderFunc {
+	switch t {
+	case valuePtrType:
+		return func(dst *Value, rv reflect.Value) error {
+			if rv.IsNil() {
+				dst.t = T_NULL
+				return nil
+			}
+			return dst.Copy(rv.Interface().(*Value))
+		}
+	case nativeFunctorTyp:
+		return func(dst *Value, rv reflect.Value) error {
+			return dst.SetNativeFunctor(rv.Interface().(NativeFunctor))
+		}
+	case nativeFuncType:
+		return func(dst *Value, rv reflect.Value) error {
+			return dst.SetNativeFunc(rv.Interface().(NativeFunc))
+		}
+	}
+	switch t.Kind() {
+	case reflect.Bool:
+		return func(dst *Value, rv reflect.Value) error {
+			return dst.SetBool(rv.Bool())
+		}
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		return func(dst *Value, rv reflect.Value) error {
+			return setInt64(dst, rv.Int())
+		}
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		return func(dst *Value, rv reflect.Value) error {
+			u := rv.Uint()
+			if u > maxExactInt {
+				return errIntRange(u)
+			}
+			return setInt64(dst, int64(u))
+		}
+	case reflect.Float32, reflect.Float64:
+		return func(dst *Value, rv reflect.Value) error {
+			return dst.SetFloat(rv.Float())
+		}
+	case reflect.String:
+		return func(dst *Value, rv reflect.Value) error {
+			return dst.SetString(rv.String())
+		}
+	case reflect.Ptr:
+		elem := typeEncoder(t.Elem())
+		return func(dst *Value, rv reflect.Value) error {
+			if rv.IsNil() {
+				dst.t = T_NULL
+				return nil
+			}
+			return elem(dst, rv.Elem())
+		}
+	case reflect.Interface:
+		return func(dst *Value, rv reflect.Value) error {
+			if rv.IsNil() {
+				dst.t = T_NULL
+				return nil
+			}
+			e := rv.Elem()
+			return typeEncoder(e.Type())(dst, e)
+		}
+	case reflect.Slice:
+		return newSliceEncoder(t)
+	case reflect.Array:
+		return newArrayEncoder(t)
+	case reflect.Map:
+		return newMapEncoder(t)
+	case reflect.Struct:
+		return newStructEncoder(t)
+	}
+	return func(dst *Value, rv reflect.Value) error {
+		return unsupportedType("Marshal", t)
+	}
+}
+
+func newSliceEncoder(t reflect.Type) encoderFunc {
+	var enc encoderFunc
+	switch {
+	case t.Elem().Kind() == reflect.Uint8:
+		enc = func(dst *Value, rv reflect.Value) error {
+			return dst.SetBytes(rv.Bytes())
+		}
+	case t.ConvertibleTo(intSliceType) && t.Elem().Kind() == reflect.Int:
+		enc = func(dst *Value, rv reflect.Value) error {
+			return dst.AppendSlice(rv.Convert(intSliceType).Interface())
+		}
+	case t.ConvertibleTo(floatSliceType) && t.Elem().Kind() == reflect.Float64:
+		enc = func(dst *Value, rv reflect.Value) error {
+			return dst.AppendSlice(rv.Convert(floatSliceType).Interface())
+		}
+	case t.ConvertibleTo(stringSliceType) && t.Elem().Kind() == reflect.String:
+		enc = func(dst *Value, rv reflect.Value) error {
+			return dst.AppendSlice(rv.Convert(stringSliceType).Interface())
+		}
+	default:
+		enc = newArrayEncoder(t)
+	}
+	// a nil slice is null, whichever path encodes the others
+	return func(dst *Value, rv reflect.Value) error {
+		if rv.IsNil() {
+			dst.t = T_NULL
+			return nil
+		}
+		return enc(dst, rv)
+	}
+}
+
+func newArrayEncoder(t reflect.Type) encoderFunc {
+	elem := typeEncoder(t.Elem())
+	return func(dst *Value, rv reflect.Value) error {
+		n := rv.Len()
+		if n == 0 {
+			return dst.AppendSlice([]*Value{})
+		}
+		cdst := (*C.VALUE)(unsafe.Pointer(dst))
+		item := newTempValue()
+		defer item.clear()
+		for i := 0; i < n; i++ {
+			if err := elem(item, rv.Index(i)); err != nil {
+				return err
+			}
+			r := C.ValueNthElementValueSet(cdst, C.INT(i), (*C.VALUE)(unsafe.Pointer(item)))
+			if err := wrapValueResult(VALUE_RESULT(r), "ValueNthElementValueSet"); err != nil {
+				return err
+			}
+			item.clear()
+		}
+		return nil
+	}
+}
+
+func newMapEncoder(t reflect.Type) encoderFunc {
+	keyEnc := typeEncoder(t.Key())
+	elem := typeEncoder(t.Elem())
+	return func(dst *Value, rv reflect.Value) error {
+		if rv.IsNil() {
+			dst.t = T_NULL
+			return nil
+		}
+		if rv.Len() == 0 {
+			return dst.ConvertFromString("{}", CVT_JSON_LITERAL)
+		}
+		cdst := (*C.VALUE)(unsafe.Pointer(dst))
+		key, item := newTempValue(), newTempValue()
+		defer key.clear()
+		defer item.clear()
+		iter := rv.MapRange()
+		for iter.Next() {
+			if err := keyEnc(key, iter.Key()); err != nil {
+				return err
+			}
+			if err := elem(item, iter.Value()); err != nil {
+				return err
+			}
+			r := C.ValueSetValueToKey(cdst, (*C.VALUE)(unsafe.Pointer(key)), (*C.VALUE)(unsafe.Pointer(item)))
+			if err := wrapValueResult(VALUE_RESULT(r), "ValueSetValueToKey"); err != nil {
+				return err
+			}
+			key.clear()
+			item.clear()
+		}
+		return nil
+	}
+}
+
+// codecField is a struct field as seen by Marshal/Unmarshal
+type codecField struct {
+	name      string
+	index     []int
+	typ       reflect.Type
+	omitEmpty bool
+	key       *ValueKey
+}
+
+// cachedFields returns the exported fields of struct type t, with fields of
+// embedded structs promoted as encoding/json does (the outer name wins).
+func cachedFields(t reflect.Type) []codecField {
+	if f, ok := fieldCache.Load(t); ok {
+		return f.([]codecField)
+	}
+	fields := make([]codecField, 0, t.NumField())
+	seen := make(map[string]bool)
+	var walk func(t reflect.Type, index []int)
+	walk = func(t reflect.Type, index []int) {
+		var embedded [][]int
+		for i := 0; i < t.NumField(); i++ {
+			sf := t.Field(i)
+			tag := sf.Tag.Get("sciter")
+			if tag == "-" {
+				continue
+			}
+			name, opts := tag, ""
+			if comma := strings.IndexByte(tag, ','); comma >= 0 {
+				name, opts = tag[:comma], tag[comma+1:]
+			}
+			idx := append(append([]int(nil), index...), i)
+			if sf.Anonymous && name == "" && sf.Type.Kind() == reflect.Struct {
+				embedded = append(embedded, idx)
+				continue
+			}
+			if sf.PkgPath != "" {
+				continue // unexported
+			}
+			if name == "" {
+				name = sf.Name
+			}
+			if seen[name] {
+				continue
+			}
+			seen[name] = true
+			fields = append(fields, codecField{
+				name:      name,
+				index:     idx,
+				typ:       sf.Type,
+				omitEmpty: strings.Contains(","+opts+",", ",omitempty,"),
+				key:       InternKey(name),
+			})
+		}
+		for _, idx := range embedded {
+			walk(t.FieldByIndex(idx[len(idx)-1:]).Type, idx)
+		}
+	}
+	walk(t, nil)
+	f, _ := fieldCache.LoadOrStore(t, fields)
+	return f.([]codecField)
+}
+
+func newStructEncoder(t reflect.Type) encoderFunc {
+	fields := cachedFields(t)
+	encs := make([]encoderFunc, len(fields))
+	for i := range fields {
+		encs[i] = typeEncoder(fields[i].typ)
+	}
+	return func(dst *Value, rv reflect.Value) error {
+		cdst := (*C.VALUE)(unsafe.Pointer(dst))
+		item := newTempValue()
+		defer item.clear()
+		for i := range fields {
+			f := &fields[i]
+			fv := rv.FieldByIndex(f.index)
+			if f.omitEmpty && isEmptyValue(fv) {
+				continue
+			}
+			if err := encs[i](item, fv); err != nil {
+				return err
+			}
+			r := C.ValueSetValueToKey(cdst, (*C.VALUE)(unsafe.Pointer(f.key.Value())), (*C.VALUE)(unsafe.Pointer(item)))
+			if err := wrapValueResult(VALUE_RESULT(r), "ValueSetValueToKey"); err != nil {
+				return err
+			}
+			item.clear()
+		}
+		if dst.IsUndefined() {
+			// every field was omitted
+			return dst.ConvertFromString("{}", CVT_JSON_LITERAL)
+		}
+		return nil
+	}
+}
+
+func isEmptyValue(v reflect.Value) bool {
+	switch v.Kind() {
+	case reflect.Array, reflect.Map, reflect.Slice, reflect.String:
+		return v.Len() == 0
+	case reflect.Bool:
+		return !v.Bool()
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		return v.Int() == 0
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		return v.Uint() == 0
+	case reflect.Float32, reflect.Float64:
+		return v.Float() == 0
+	case reflect.Interface, reflect.Ptr, reflect.Func:
+		return v.IsNil()
+	}
+	return false
+}
+
+// typeDecoder returns the cached decoder of t, compiling it on first use.
+func typeDecoder(t reflect.Type) decoderFunc {
+	if f, ok := decoderCache.Load(t); ok {
+		return f.(decoderFunc)
+	}
+	var (
+		wg sync.WaitGroup
+		f  decoderFunc
+	)
+	wg.Add(1)
+	fi, loaded := decoderCache.LoadOrStore(t, decoderFunc(func(src *Value, rv reflect.Value) error {
+		wg.Wait()
+		return f(src, rv)
+	}))
+	if loaded {
+		return fi.(decoderFunc)
+	}
+	f = newTypeDecoder(t)
+	wg.Done()
+	decoderCache.Store(t, f)
+	return f
+}
+
+func newTypeDecoder(t reflect.Type) decoderFunc {
+	if t == valuePtrType {
+		return func(src *Value, rv reflect.Value) error {
+			rv.Set(reflect.ValueOf(src.Clone()))
+			return nil
+		}
+	}
+	switch t.Kind() {
+	case reflect.Bool:
+		return func(src *Value, rv reflect.Value) error {
+			rv.SetBool(src.Bool())
+			return nil
+		}
+	case reflect.Int, reflect.Int8, reflect.Int16, reflect.Int32, reflect.Int64:
+		return func(src *Value, rv reflect.Value) error {
+			if src.IsFloat() {
+				rv.SetInt(int64(src.Float()))
+			} else {
+				rv.SetInt(int64(src.Int()))
+			}
+			return nil
+		}
+	case reflect.Uint, reflect.Uint8, reflect.Uint16, reflect.Uint32, reflect.Uint64, reflect.Uintptr:
+		return func(src *Value, rv reflect.Value) error {
+			if src.IsFloat() {
+				rv.SetUint(uint64(src.Float()))
+			} else {
+				rv.SetUint(uint64(src.Int()))
+			}
+			return nil
+		}
+	case reflect.Float32, reflect.Float64:
+		return func(src *Value, rv reflect.Value) error {
+			if src.IsInt() {
+				rv.SetFloat(float64(src.Int()))
+			} else {
+				rv.SetFloat(src.Float())
+			}
+			return nil
+		}
+	case reflect.String:
+		return func(src *Value, rv reflect.Value) error {
+			rv.SetString(src.String())
+			return nil
+		}
+	case reflect.Ptr:
+		elem := typeDecoder(t.Elem())
+		return func(src *Value, rv reflect.Value) error {
+			if src.IsUndefined() || src.IsNull() {
+				rv.Set(reflect.Zero(t))
+				return nil
+			}
+			if rv.IsNil() {
+				rv.Set(reflect.New(t.Elem()))
+			}
+			return elem(src, rv.Elem())
+		}
+	case reflect.Interface:
+		if t.NumMethod() != 0 {
+			break
+		}
+		return func(src *Value, rv reflect.Value) error {
+			v, err := decodeInterface(src)
+			if err != nil {
+				return err
+			}
+			if v == nil {
+				rv.Set(reflect.Zero(t))
+			} else {
+				rv.Set(reflect.ValueOf(v))
+			}
+			return nil
+		}
+	case reflect.Slice:
+		return newSliceDecoder(t)
+	case reflect.Array:
+		elem := typeDecoder(t.Elem())
+		return func(src *Value, rv reflect.Value) error {
+			return decodeElements(src, rv, rv.Len(), elem)
+		}
+	case reflect.Map:
+		return newMapDecoder(t)
+	case reflect.Struct:
+		return newStructDecoder(t)
+	}
+	return func(src *Value, rv reflect.Value) error {
+		return unsupportedType("Unmarshal", t)
+	}
+}
+
+// decodeElements decodes the first n elements of src into rv[0:n]
+func decodeElements(src *Value, rv reflect.Value, n int, elem decoderFunc) error {
+	csrc := (*C.VALUE)(unsafe.Pointer(src))
+	item := newTempValue()
+	defer item.clear()
+	for i := 0; i < n; i++ {
+		r := C.ValueNthElementValue(csrc, C.INT(i), (*C.VALUE)(unsafe.Pointer(item)))
+		if err := wrapValueResult(VALUE_RESULT(r), "ValueNthElementValue"); err != nil {
+			return err
+		}
+		if err := elem(item, rv.Index(i)); err != nil {
+			return err
+		}
+		item.clear()
+	}
+	return nil
+}
+
+func newSliceDecoder(t reflect.Type) decoderFunc {
+	// the ToSlice fast paths only apply to the plain slice types themselves
+	var bulk reflect.Type
+	switch t {
+	case intSliceType, floatSliceType, stringSliceType:
+		bulk = t
+	}
+	isBytes := t.Elem().Kind() == reflect.Uint8
+	elem := typeDecoder(t.Elem())
+	return func(src *Value, rv reflect.Value) error {
+		if src.IsUndefined() || src.IsNull() {
+			rv.Set(reflect.Zero(t))
+			return nil
+		}
+		if isBytes && src.IsByte() {
+			rv.SetBytes(src.Bytes())
+			return nil
+		}
+		if bulk != nil {
+			return src.ToSlice(rv.Addr().Interface())
+		}
+		n := src.Length()
+		s := reflect.MakeSlice(t, n, n)
+		if err := decodeElements(src, s, n, elem); err != nil {
+			return err
+		}
+		rv.Set(s)
+		return nil
+	}
+}
+
+func newMapDecoder(t reflect.Type) decoderFunc {
+	keyDec := typeDecoder(t.Key())
+	elem := typeDecoder(t.Elem())
+	return func(src *Value, rv reflect.Value) error {
+		if src.IsUndefined() || src.IsNull() {
+			rv.Set(reflect.Zero(t))
+			return nil
+		}
+		entries, err := src.Entries()
+		if err != nil {
+			return err
+		}
+		defer entries.Release()
+		if rv.IsNil() {
+			rv.Set(reflect.MakeMapWithSize(t, entries.Len()))
+		}
+		for i := 0; i < entries.Len(); i++ {
+			kv := reflect.New(t.Key()).Elem()
+			if err := keyDec(entries.Key(i), kv); err != nil {
+				return err
+			}
+			ev := reflect.New(t.Elem()).Elem()
+			if err := elem(entries.Value(i), ev); err != nil {
+				return err
+			}
+			rv.SetMapIndex(kv, ev)
+		}
+		return nil
+	}
+}
+
+func newStructDecoder(t reflect.Type) decoderFunc {
+	fields := cachedFields(t)
+	decs := make([]decoderFunc, len(fields))
+	for i := range fields {
+		decs[i] = typeDecoder(fields[i].typ)
+	}
+	return func(src *Value, rv reflect.Value) error {
+		if src.IsUndefined() || src.IsNull() {
+			return nil
+		}
+		if !src.IsMap() && !src.IsObject() {
+			return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("Unmarshal: cannot decode %s into %s", src, t))
+		}
+		csrc := (*C.VALUE)(unsafe.Pointer(src))
+		item := newTempValue()
+		defer item.clear()
+		for i := range fields {
+			f := &fields[i]
+			r := C.ValueGetValueOfKey(csrc, (*C.VALUE)(unsafe.Pointer(f.key.Value())), (*C.VALUE)(unsafe.Pointer(item)))
+			if VALUE_RESULT(r) == HV_OK && !item.IsUndefined() {
+				if err := decs[i](item, rv.FieldByIndex(f.index)); err != nil {
+					return err
+				}
+			}
+			item.clear()
+		}
+		return nil
+	}
+}
+
+// decodeInterface converts src to the natural go type of its content
+func decodeInterface(src *Value) (interface{}, error) {
+	switch {
+	case src.IsUndefined(), src.IsNull():
+		return nil, nil
+	case src.IsBool():
+		return src.Bool(), nil
+	case src.IsInt():
+		return src.Int(), nil
+	case src.IsFloat():
+		return src.Float(), nil
+	case src.IsString():
+		return src.String(), nil
+	case src.IsByte():
+		return src.Bytes(), nil
+	case src.IsArray():
+		var s []interface{}
+		err := typeDecoder(reflect.TypeOf(s))(src, reflect.ValueOf(&s).Elem())
+		return s, err
+	case src.IsMap():
+		var m map[string]interface{}
+		err := typeDecoder(reflect.TypeOf(m))(src, reflect.ValueOf(&m).Elem())
+		return m, err
+	}
+	return src.Clone(), nil
+}
@@ -0,0 +1,159 @@
+package sciter
+
+import "testing"
+
+func TestTypedFastFunc(t *testing.T) {
+	type handler func(int) int
+	for _, c := range []struct {
+		fn   interface{}
+		fast bool
+	}{
+		{func() {}, true},
+		{func(int, int) int { return 0 }, true},
+		{func(string) (string, error) { return "", nil }, true},
+		{func(int, string) int { return 0 }, false},
+		{handler(func(int) int { return 0 }), false},
+	} {
+		if got := typedFastFunc(c.fn) != nil; got != c.fast {
+			t.Errorf("%T: fast path %v, want %v", c.fn, got, c.fast)
+		}
+	}
+}
+
+// intArgs returns initialized Values holding ns, as the engine passes arguments
+func intArgs(ns ...int) []Value {
+	args := make([]Value, len(ns))
+	for i, n := range ns {
+		args[i].init()
+		args[i].SetInt(n)
+	}
+	return args
+}
+
+func TestTypedFuncAllocs(t *testing.T) {
+	requireEngine(t)
+	f, err := TypedFunc(func(a, b int) int { return a + b })
+	if err != nil {
+		t.Fatal(err)
+	}
+	args := intArgs(2, 3)
+	retval := newTempValue()
+	defer retval.clear()
+	allocs := testing.AllocsPerRun(100, func() {
+		f(args, retval)
+	})
+	if allocs != 0 {
+		t.Errorf("%v allocations per call, want 0", allocs)
+	}
+	if retval.Int() != 5 {
+		t.Errorf("result %d, want 5", retval.Int())
+	}
+}
+
+func BenchmarkTypedFunc(b *testing.B) {
+	requireEngine(b)
+	for _, c := range []struct {
+		name string
+		fn   interface{}
+	}{
+		{"fast", func(a, b int) int { return a + b }},
+		// a named type does not match the fast paths
+		{"reflect", func() interface{} {
+			type add func(a, b int) int
+			return add(func(a, b int) int { return a + b })
+		}()},
+	} {
+		b.Run(c.name, func(b *testing.B) {
+			f, err := TypedFunc(c.fn)
+			if err != nil {
+				b.Fatal(err)
+			}
+			args := intArgs(2, 3)
+			retval := newTempValue()
+			defer retval.clear()
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				f(args, retval)
+			}
+			if retval.Int() != 5 {
+				b.Fatalf("result %d, want 5", retval.Int())
+			}
+		})
+	}
+}
+
+func TestMarshalNilSlices(t *testing.T) {
+	requireEngine(t)
+	for _, val := range []interface{}{[]int(nil), []float64(nil), []string(nil), []byte(nil), []bool(nil)} {
+		v, err := Marshal(val)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !v.IsNull() {
+			t.Errorf("%T(nil) marshals to %s, want null", val, v.String())
+		}
+		v.Release()
+	}
+}
+
+// BenchmarkMarshal compares the cached conversion plans of Marshal with
+// building the same Value one Set or Append at a time
+func BenchmarkMarshal(b *testing.B) {
+	requireEngine(b)
+	records := benchRecords(16 << 10)
+	b.Run("SetChain", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			buildTree(records).Release()
+		}
+	})
+	b.Run("plan", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			v, err := Marshal(records)
+			if err != nil {
+				b.Fatal(err)
+			}
+			v.Release()
+		}
+	})
+	v, err := Marshal(records)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer v.Release()
+	b.Run("Unmarshal", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			var out []benchRecord
+			if err := Unmarshal(v, &out); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
+
+func TestMarshalInt64RoundTrip(t *testing.T) {
+	requireEngine(t)
+	for _, n := range []int64{1 << 40, -1 << 40, 1<<31 - 1, -1 << 31, 1 << 53} {
+		v, err := Marshal(n)
+		if err != nil {
+			t.Fatal(err)
+		}
+		var got int64
+		if err := Unmarshal(v, &got); err != nil {
+			t.Fatal(err)
+		}
+		v.Release()
+		if got != n {
+			t.Errorf("%d read back as %d", n, got)
+		}
+	}
+	for _, val := range []interface{}{int64(1<<53 + 1), uint64(1 << 63)} {
+		if v, err := Marshal(val); err == nil {
+			v.Release()
+			t.Errorf("%v marshalled without an error", val)
+		}
+	}
+}
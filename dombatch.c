@@ -0,0 +1,36 @@
+#include "dombatch.h"
+
+// Replays the command buffer recorded by DOMBatch (dombatch.go) in one go.
+// Returns the result of the first failing command, its index goes to *pfailed.
+// update, if not NULL, gets a single SciterUpdateElement once all commands ran.
+SCDOM_RESULT DOMBatchRun( const BYTE* buf, UINT size, HELEMENT update, UINT* pfailed )
+{
+  UINT index = 0;
+  for( UINT off = 0; off < size; ++index ) {
+    const DOM_BATCH_CMD* cmd = (const DOM_BATCH_CMD*)(buf + off);
+    HELEMENT he = (HELEMENT)(UINT_PTR)cmd->he;
+    LPCSTR s1 = (LPCSTR)(cmd + 1);
+    LPCWSTR s2 = (LPCWSTR)(buf + off + sizeof(DOM_BATCH_CMD) + ((cmd->n1 + 2) & ~1u));
+    SCDOM_RESULT r = SCDOM_OK;
+    switch( cmd->op ) {
+      case DBO_SET_TEXT:    r = SciterSetElementText(he, s2, cmd->n2); break;
+      case DBO_SET_ATTR:    r = SciterSetAttributeByName(he, s1, s2); break;
+      case DBO_REMOVE_ATTR: r = SciterSetAttributeByName(he, s1, NULL); break;
+      case DBO_SET_STYLE:   r = SciterSetStyleAttribute(he, s1, s2); break;
+      case DBO_SET_HTML:    r = SciterSetElementHtml(he, (LPCBYTE)s1, cmd->n1, cmd->a); break;
+      case DBO_INSERT:      r = SciterInsertElement(he, (HELEMENT)(UINT_PTR)cmd->he2, cmd->a); break;
+      case DBO_DETACH:      r = SciterDetachElement(he); break;
+      case DBO_DELETE:      r = SciterDeleteElement(he); break;
+      case DBO_SET_STATE:   r = SciterSetElementState(he, cmd->a, cmd->b, FALSE); break;
+      default:              r = SCDOM_INVALID_PARAMETER; break;
+    }
+    if( r != SCDOM_OK ) {
+      *pfailed = index;
+      return r;
+    }
+    off += cmd->size;
+  }
+  if( update )
+    return SciterUpdateElement(update, TRUE);
+  return SCDOM_OK;
+}
@@ -0,0 +1,184 @@
+package sciter
+
+/*
+#include "dombatch.h"
+*/
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// DOMBatch records DOM mutations and applies them all in a single cgo call.
+//
+// Updating many elements one SetText/SetAttr/SetStyle at a time costs a cgo
+// crossing and a utf-16 conversion per call; a batch encodes the commands
+// into one compact buffer and Run replays it on the C side (dombatch.c),
+// optionally followed by a single SciterUpdateElement.
+//
+// Recorded elements are retained until Reset, so borrowed elements may be
+// recorded from within event handlers.
+type DOMBatch struct {
+	buf   []byte
+	count int
+	// keeps the recorded elements alive until Run
+	keep []*Element
+}
+
+const domBatchCmdSize = int(unsafe.Sizeof(C.DOM_BATCH_CMD{}))
+
+func NewDOMBatch() *DOMBatch {
+	return &DOMBatch{buf: make([]byte, 0, 4096)}
+}
+
+// Len returns the number of recorded commands
+func (b *DOMBatch) Len() int {
+	return b.count
+}
+
+// Reset drops all recorded commands, keeping the buffer for reuse
+func (b *DOMBatch) Reset() {
+	b.buf = b.buf[:0]
+	b.count = 0
+	for i := range b.keep {
+		b.keep[i] = nil
+	}
+	b.keep = b.keep[:0]
+}
+
+func (b *DOMBatch) element(e *Element) C.UINT64 {
+	if e.borrowed {
+		e = e.Retain()
+	}
+	b.keep = append(b.keep, e)
+	return C.UINT64(uintptr(unsafe.Pointer(e.handle)))
+}
+
+// add appends a command with its payload: s1 as NUL terminated utf-8,
+// s2 (when hasS2) as NUL terminated utf-16
+func (b *DOMBatch) add(op C.UINT, e *Element, s1 string, s2 string, hasS2 bool) *C.DOM_BATCH_CMD {
+	n2 := 0
+	if hasS2 {
+		for _, r := range s2 {
+			n2++
+			// runes above the BMP take two words
+			if r >= 0x10000 {
+				n2++
+			}
+		}
+	}
+	off := len(b.buf)
+	n1Size := (len(s1) + 2) &^ 1
+	size := domBatchCmdSize + n1Size + 2*(n2+1)
+	size = (size + 7) &^ 7
+	if cap(b.buf)-off < size {
+		grown := make([]byte, off, 2*cap(b.buf)+size)
+		copy(grown, b.buf)
+		b.buf = grown
+	}
+	b.buf = b.buf[:off+size]
+	rec := b.buf[off : off+size]
+	for i := domBatchCmdSize; i < len(rec); i++ {
+		rec[i] = 0
+	}
+	copy(rec[domBatchCmdSize:], s1)
+	if hasS2 {
+		u16 := (*[1 << 29]uint16)(unsafe.Pointer(&rec[domBatchCmdSize+n1Size]))[: 0 : n2+1]
+		appendUtf16(u16, s2)
+	}
+	cmd := (*C.DOM_BATCH_CMD)(unsafe.Pointer(&rec[0]))
+	*cmd = C.DOM_BATCH_CMD{
+		op:   op,
+		size: C.UINT(size),
+		he:   b.element(e),
+		n1:   C.UINT(len(s1)),
+		n2:   C.UINT(n2),
+	}
+	b.count++
+	return cmd
+}
+
+// SetText records Element.SetText
+func (b *DOMBatch) SetText(e *Element, text string) {
+	b.add(C.DBO_SET_TEXT, e, "", text, true)
+}
+
+// SetAttr records Element.SetAttr
+func (b *DOMBatch) SetAttr(e *Element, name, val string) {
+	b.add(C.DBO_SET_ATTR, e, name, val, true)
+}
+
+// RemoveAttr records the removal of the attribute name
+func (b *DOMBatch) RemoveAttr(e *Element, name string) {
+	b.add(C.DBO_REMOVE_ATTR, e, name, "", false)
+}
+
+// SetStyle records Element.SetStyle
+func (b *DOMBatch) SetStyle(e *Element, name, val string) {
+	b.add(C.DBO_SET_STYLE, e, name, val, true)
+}
+
+// SetHtml records Element.SetHtml
+func (b *DOMBatch) SetHtml(e *Element, html string, where SET_ELEMENT_HTML) {
+	if len(html) == 0 {
+		b.SetText(e, "")
+		return
+	}
+	b.add(C.DBO_SET_HTML, e, html, "", false).a = C.UINT(where)
+}
+
+// Insert records parent.Insert(el, index)
+func (b *DOMBatch) Insert(parent, el *Element, index int) {
+	cmd := b.add(C.DBO_INSERT, el, "", "", false)
+	cmd.he2 = b.element(parent)
+	cmd.a = C.UINT(index)
+}
+
+// Append records parent.Append(el)
+func (b *DOMBatch) Append(parent, el *Element) {
+	b.Insert(parent, el, 0x7FFFFFFF)
+}
+
+// Detach records Element.Detach
+func (b *DOMBatch) Detach(e *Element) {
+	b.add(C.DBO_DETACH, e, "", "", false)
+}
+
+// Delete records Element.Delete
+func (b *DOMBatch) Delete(e *Element) {
+	b.add(C.DBO_DELETE, e, "", "", false)
+}
+
+// SetState records Element.SetState, without updating the view
+func (b *DOMBatch) SetState(e *Element, bitsToSet, bitsToClear ElementState) {
+	cmd := b.add(C.DBO_SET_STATE, e, "", "", false)
+	cmd.a = C.UINT(bitsToSet)
+	cmd.b = C.UINT(bitsToClear)
+}
+
+// Run applies the recorded commands in order and stops at the first failing one.
+// If update is not nil, it gets a single Update(true) after all commands.
+// The batch is Reset afterwards, whatever the outcome.
+func (b *DOMBatch) Run(update *Element) error {
+	defer b.Reset()
+	if b.count == 0 && update == nil {
+		return nil
+	}
+	// args
+	var cbuf *C.BYTE
+	if len(b.buf) > 0 {
+		cbuf = (*C.BYTE)(unsafe.Pointer(&b.buf[0]))
+	}
+	cupdate := BAD_HELEMENT
+	if update != nil {
+		cupdate = update.handle
+	}
+	// only set when a command fails
+	failed := C.UINT(b.count)
+	// cgo call
+	r := C.DOMBatchRun(cbuf, C.UINT(len(b.buf)), cupdate, &failed)
+	if r != C.INT(SCDOM_OK) && int(failed) < b.count {
+		return wrapDomResult(r, fmt.Sprintf("DOMBatch: command %d", failed))
+	}
+	return wrapDomResult(r, "DOMBatch")
+}
@@ -0,0 +1,37 @@
+#ifndef DOMBATCH_H
+#define DOMBATCH_H
+
+#include "sciter-x.h"
+
+// Command buffer layout shared by dombatch.go and dombatch.c.
+//
+// Every command is a DOM_BATCH_CMD header followed by its payload, padded to
+// 8 bytes: n1 bytes of NUL terminated utf-8 (attribute/style name or html),
+// padded to 2, then n2 utf-16 words plus a NUL (text or value).
+
+enum DOM_BATCH_OP {
+  DBO_SET_TEXT    = 1,
+  DBO_SET_ATTR    = 2,
+  DBO_REMOVE_ATTR = 3,
+  DBO_SET_STYLE   = 4,
+  DBO_SET_HTML    = 5,
+  DBO_INSERT      = 6,
+  DBO_DETACH      = 7,
+  DBO_DELETE      = 8,
+  DBO_SET_STATE   = 9,
+};
+
+typedef struct {
+  UINT   op;
+  UINT   size;   // of the whole command, payload included
+  UINT64 he;
+  UINT64 he2;    // parent of DBO_INSERT
+  UINT   a;      // html 'where', insert index or state bits to set
+  UINT   b;      // state bits to clear
+  UINT   n1;     // utf-8 bytes, NUL excluded
+  UINT   n2;     // utf-16 words, NUL excluded
+} DOM_BATCH_CMD;
+
+SCDOM_RESULT DOMBatchRun( const BYTE* buf, UINT size, HELEMENT update, UINT* pfailed );
+
+#endif
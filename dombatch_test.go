@@ -0,0 +1,109 @@
+package sciter
+
+import (
+	"strconv"
+	"testing"
+)
+
+// recordRows records the updates of a table of rows, the way a list refresh does
+func recordRows(b *DOMBatch, rows []*Element, labels []string) {
+	for i, row := range rows {
+		b.SetText(row, labels[i])
+		b.SetAttr(row, "data-index", labels[i])
+		b.SetStyle(row, "height", "24px")
+	}
+}
+
+func benchRows(n int) ([]*Element, []string) {
+	rows := make([]*Element, n)
+	labels := make([]string, n)
+	for i := range rows {
+		rows[i] = fakeElement(i)
+		labels[i] = "row " + strconv.Itoa(i) + " — ✓"
+	}
+	return rows, labels
+}
+
+func TestDOMBatchRecordAllocs(t *testing.T) {
+	rows, labels := benchRows(100)
+	batch := NewDOMBatch()
+	// the first round grows the buffers
+	recordRows(batch, rows, labels)
+	batch.Reset()
+	allocs := testing.AllocsPerRun(100, func() {
+		recordRows(batch, rows, labels)
+		batch.Reset()
+	})
+	if allocs != 0 {
+		t.Errorf("%v allocations per batch, want 0", allocs)
+	}
+	recordRows(batch, rows, labels)
+	if batch.Len() != 3*len(rows) {
+		t.Errorf("%d commands, want %d", batch.Len(), 3*len(rows))
+	}
+	batch.Reset()
+}
+
+func BenchmarkDOMBatchRecord(b *testing.B) {
+	for _, n := range []int{10, 100, 1000} {
+		b.Run(strconv.Itoa(n), func(b *testing.B) {
+			rows, labels := benchRows(n)
+			batch := NewDOMBatch()
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				recordRows(batch, rows, labels)
+				batch.Reset()
+			}
+			b.StopTimer()
+			recordRows(batch, rows, labels)
+			b.Logf("%d rows: %.1f bytes per command", n, float64(len(batch.buf))/float64(batch.Len()))
+			batch.Reset()
+		})
+	}
+}
+
+// BenchmarkDOMBatchApply applies the same row updates through one DOMBatch.Run
+// and through a SetText, SetAttr and SetStyle call per row
+func BenchmarkDOMBatchApply(b *testing.B) {
+	for _, n := range []int{10, 100, 1000} {
+		b.Run(strconv.Itoa(n), func(b *testing.B) {
+			requireEngine(b)
+			_, labels := benchRows(n)
+			rows := make([]*Element, n)
+			for i := range rows {
+				row, err := CreateElement("li", "")
+				if err != nil {
+					b.Fatal(err)
+				}
+				rows[i] = row
+			}
+			b.Run("batch", func(b *testing.B) {
+				batch := NewDOMBatch()
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					recordRows(batch, rows, labels)
+					if err := batch.Run(nil); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+			b.Run("calls", func(b *testing.B) {
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					for j, row := range rows {
+						if err := row.SetText(labels[j]); err != nil {
+							b.Fatal(err)
+						}
+						if err := row.SetAttr("data-index", labels[j]); err != nil {
+							b.Fatal(err)
+						}
+						if err := row.SetStyle("height", "24px"); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+		})
+	}
+}
@@ -0,0 +1,168 @@
+#include <string.h>
+#include "sciter-x.h"
+
+// DOM helpers for sciter.go.
+// Each of them does in one call what would otherwise take a cgo crossing
+// (and often a receiver callback) per attribute or element.
+
+typedef struct {
+  BYTE* buf;
+  UINT  cap;
+  UINT  size;
+} packed_buf;
+
+// appends a UINT length and len bytes of data, padded to 4,
+// only counting the size once the buffer is full
+static void packed_put( packed_buf* b, const void* data, UINT len )
+{
+  UINT need = (sizeof(UINT) + len + 3) & ~3u;
+  if( b->size + need <= b->cap ) {
+    memcpy(b->buf + b->size, &len, sizeof(UINT));
+    memcpy(b->buf + b->size + sizeof(UINT), data, len);
+  }
+  b->size += need;
+}
+
+static VOID SC_CALLBACK attr_name_receiver( LPCSTR str, UINT str_length, LPVOID param )
+{
+  packed_buf* b = (packed_buf*)param;
+  packed_put(b, str, str_length);
+}
+
+static VOID SC_CALLBACK attr_value_receiver( LPCWSTR str, UINT str_length, LPVOID param )
+{
+  packed_buf* b = (packed_buf*)param;
+  packed_put(b, str, str_length * sizeof(WCHAR));
+}
+
+// Packs all attributes of he into buf as (name, value) records: the utf-8 name
+// then the utf-16 value, each a UINT byte length followed by the bytes padded to 4.
+// *psize receives the size of the whole pack, which may exceed cap: the
+// caller then retries with a larger buffer.
+SCDOM_RESULT ElementGetAttributes( HELEMENT he, BYTE* buf, UINT cap, UINT* psize, UINT* pcount )
+{
+  packed_buf b = { buf, cap, 0 };
+  UINT count = 0;
+  *psize = 0;
+  *pcount = 0;
+  SCDOM_RESULT r = SciterGetAttributeCount(he, &count);
+  if( r != SCDOM_OK )
+    return r;
+  for( UINT i = 0; i < count; ++i ) {
+    // every call must leave exactly one record, the receiver is not called
+    // for e.g. a valueless attribute: an empty record stands for it then
+    UINT size = b.size;
+    r = SciterGetNthAttributeNameCB(he, i, attr_name_receiver, &b);
+    if( r != SCDOM_OK )
+      return r;
+    if( b.size == size )
+      packed_put(&b, "", 0);
+    size = b.size;
+    r = SciterGetNthAttributeValueCB(he, i, attr_value_receiver, &b);
+    if( r != SCDOM_OK )
+      return r;
+    if( b.size == size )
+      packed_put(&b, "", 0);
+  }
+  *psize = b.size;
+  *pcount = count;
+  return SCDOM_OK;
+}
+
+// Stores the handles of the first n children of he into out, returns how many were stored.
+// The handles are not Sciter_UseElement'ed.
+UINT ElementGetChildren( HELEMENT he, HELEMENT* out, UINT n )
+{
+  UINT count = 0;
+  if( SciterGetChildrenCount(he, &count) != SCDOM_OK )
+    return 0;
+  if( count > n )
+    count = n;
+  for( UINT i = 0; i < count; ++i ) {
+    if( SciterGetNthChild(he, i, &out[i]) != SCDOM_OK )
+      return i;
+  }
+  return count;
+}
+
+typedef struct {
+  LPCSTR name;
+  INT    order; // 1 or -1 for descending
+} attr_sort;
+
+typedef struct {
+  double value;
+  SBOOL  valid;
+} attr_number;
+
+// parses a decimal number the way CSS and script literals are written,
+// independently of the C locale (GTK sets it from the environment)
+static VOID SC_CALLBACK attr_number_receiver( LPCWSTR str, UINT str_length, LPVOID param )
+{
+  attr_number* pn = (attr_number*)param;
+  UINT i = 0;
+  double v = 0, sign = 1, scale = 1;
+  INT exp = 0, exp_sign = 1, digits = 0;
+  while( i < str_length && (str[i] == ' ' || str[i] == '\t') ) ++i;
+  if( i < str_length && (str[i] == '-' || str[i] == '+') ) sign = str[i++] == '-' ? -1 : 1;
+  for( ; i < str_length && str[i] >= '0' && str[i] <= '9'; ++i, ++digits ) v = v * 10 + (str[i] - '0');
+  if( i < str_length && str[i] == '.' )
+    for( ++i; i < str_length && str[i] >= '0' && str[i] <= '9'; ++i, ++digits ) v += (str[i] - '0') * (scale /= 10);
+  if( digits && i < str_length && (str[i] == 'e' || str[i] == 'E') ) {
+    ++i;
+    if( i < str_length && (str[i] == '-' || str[i] == '+') ) exp_sign = str[i++] == '-' ? -1 : 1;
+    for( ; i < str_length && str[i] >= '0' && str[i] <= '9'; ++i ) if( exp < 400 ) exp = exp * 10 + (str[i] - '0');
+    for( ; exp > 0; --exp ) v = exp_sign > 0 ? v * 10 : v / 10;
+  }
+  while( i < str_length && (str[i] == ' ' || str[i] == '\t') ) ++i;
+  pn->value = sign * v;
+  pn->valid = digits > 0 && i == str_length;
+}
+
+static attr_number attr_as_number( HELEMENT he, LPCSTR name )
+{
+  attr_number n = { 0, FALSE };
+  SciterGetAttributeByNameCB(he, name, attr_number_receiver, &n);
+  return n;
+}
+
+// elements without the attribute or with a non numeric one go first,
+// in either order
+static INT SC_CALLBACK attr_number_comparator( HELEMENT he1, HELEMENT he2, LPVOID param )
+{
+  attr_sort* ps = (attr_sort*)param;
+  attr_number n1 = attr_as_number(he1, ps->name);
+  attr_number n2 = attr_as_number(he2, ps->name);
+  if( n1.valid != n2.valid )
+    return n1.valid ? 1 : -1;
+  if( n1.value == n2.value )
+    return 0;
+  return (n1.value < n2.value ? -1 : 1) * ps->order;
+}
+
+// Sorts children [first, last) of he by the numeric value of their attribute name,
+// entirely on the C side.
+SCDOM_RESULT ElementSortByNumericAttribute( HELEMENT he, UINT first, UINT last, LPCSTR name, SBOOL descending )
+{
+  attr_sort s = { name, descending ? -1 : 1 };
+  return SciterSortElements(he, first, last, attr_number_comparator, &s);
+}
+
+// Fills out[i] with the location of hes[i], see SciterGetElementLocation.
+// Elements that fail get an empty rect; the index of the first one goes to *pfailed
+// and its result is returned, after all elements are done.
+SCDOM_RESULT ElementsGetLocations( const HELEMENT* hes, UINT n, UINT areas, RECT* out, UINT* pfailed )
+{
+  SCDOM_RESULT first = SCDOM_OK;
+  for( UINT i = 0; i < n; ++i ) {
+    SCDOM_RESULT r = SciterGetElementLocation(hes[i], &out[i], areas);
+    if( r != SCDOM_OK ) {
+      memset(&out[i], 0, sizeof(RECT));
+      if( first == SCDOM_OK ) {
+        first = r;
+        *pfailed = i;
+      }
+    }
+  }
+  return first;
+}
@@ -0,0 +1,154 @@
+package sciter
+
+/*
+#include "sciter-x.h"
+
+extern UINT ElementGetChildren( HELEMENT he, HELEMENT* out, UINT n );
+extern SCDOM_RESULT ElementSortByNumericAttribute( HELEMENT he, UINT first, UINT last, LPCSTR name, SBOOL descending );
+*/
+import "C"
+import (
+	"fmt"
+	"sort"
+)
+
+// childKeys sorts child indices by keys of one kind
+type childKeys struct {
+	order  []int
+	ints   []int64
+	floats []float64
+	strs   []string
+}
+
+func (k *childKeys) Len() int      { return len(k.order) }
+func (k *childKeys) Swap(i, j int) { k.order[i], k.order[j] = k.order[j], k.order[i] }
+func (k *childKeys) Less(i, j int) bool {
+	a, b := k.order[i], k.order[j]
+	switch {
+	case k.ints != nil:
+		return k.ints[a] < k.ints[b]
+	case k.floats != nil:
+		return k.floats[a] < k.floats[b]
+	}
+	return k.strs[a] < k.strs[b]
+}
+
+func (k *childKeys) add(i int, key interface{}) bool {
+	switch v := key.(type) {
+	case int:
+		return k.addInt(i, int64(v))
+	case int64:
+		return k.addInt(i, v)
+	case float64:
+		if i == 0 {
+			k.floats = make([]float64, len(k.order))
+		}
+		if k.floats == nil {
+			return false
+		}
+		k.floats[i] = v
+	case string:
+		if i == 0 {
+			k.strs = make([]string, len(k.order))
+		}
+		if k.strs == nil {
+			return false
+		}
+		k.strs[i] = v
+	default:
+		return false
+	}
+	return true
+}
+
+func (k *childKeys) addInt(i int, v int64) bool {
+	if i == 0 {
+		k.ints = make([]int64, len(k.order))
+	}
+	if k.ints == nil {
+		return false
+	}
+	k.ints[i] = v
+	return true
+}
+
+// SortChildrenByKey sorts the children of the element by the key keyFn
+// returns for each of them: a string, an int, an int64 or a float64, the same
+// kind for all children. The sort is stable.
+//
+// Unlike SortChildren, which calls back into Go and wraps both elements for
+// every comparison, keyFn is called once per child and the sort runs on the
+// keys alone. The children then move in a single DOMBatch, and only those
+// outside the longest run already in order move at all.
+//
+// The child passed to keyFn is a borrowed view, Retain it to keep it.
+func (e *Element) SortChildrenByKey(keyFn func(child *Element) interface{}) error {
+	count, err := e.ChildrenCount()
+	if err != nil || count < 2 {
+		return err
+	}
+	children := make([]C.HELEMENT, count)
+	// cgo call
+	count = int(C.ElementGetChildren(e.handle, &children[0], C.UINT(count)))
+	children = children[:count]
+
+	keys := &childKeys{order: make([]int, count)}
+	for i, he := range children {
+		keys.order[i] = i
+		child := borrowElement(he)
+		key := keyFn(child)
+		child.unborrow()
+		if !keys.add(i, key) {
+			return newDomError(SCDOM_INVALID_PARAMETER, fmt.Sprintf("SortChildrenByKey: unsupported or mixed key %T", key))
+		}
+	}
+	sort.Stable(keys)
+
+	// keys.order[i] is the current index of the child going to i
+	stable := increasingRun(keys.order)
+	batch := NewDOMBatch()
+	moved := make([]*Element, count)
+	for i, j := range keys.order {
+		if !stable[i] {
+			moved[i] = WrapElement(children[j])
+			batch.Detach(moved[i])
+		}
+	}
+	for i := range keys.order {
+		// everything before i is in place, stable children are already at i
+		if moved[i] != nil {
+			batch.Insert(e, moved[i], i)
+		}
+	}
+	return batch.Run(e)
+}
+
+// SortByNumericAttr sorts count children from start by the numeric value of
+// their attribute name; children without it, or with a non numeric one, go first
+// whether descending or not.
+// The comparison runs on the C side (element.c), with no call back into Go.
+func (e *Element) SortByNumericAttr(start, count int, name string, descending bool) error {
+	sc := newScratch()
+	defer sc.release()
+	// args
+	cstart := C.UINT(start)
+	cend := C.UINT(start + count)
+	cname := sc.cstr(name)
+	cdescending := C.SBOOL(C.FALSE)
+	if descending {
+		cdescending = C.SBOOL(C.TRUE)
+	}
+	// cgo call
+	r := C.ElementSortByNumericAttribute(e.handle, cstart, cend, cname, cdescending)
+	return wrapDomResult(r, "ElementSortByNumericAttribute")
+}
+
+// SortChildrenByNumericAttr sorts all children by the numeric value of their attribute name,
+// see SortByNumericAttr.
+func (e *Element) SortChildrenByNumericAttr(name string, descending bool) error {
+	count, err := e.ChildrenCount()
+	if err != nil {
+		return err
+	}
+	return e.SortByNumericAttr(0, count, name, descending)
+}
@@ -0,0 +1,108 @@
+package sciter
+
+import (
+	"log"
+	"sync"
+)
+
+// handleTable maps the integer handles handed to C, as callback tags or
+// params, to the go values they stand for and keeps those reachable
+// meanwhile: C never holds a go pointer, and the slots of released handles
+// are reused, so the table does not grow with values that come and go.
+//
+// A handle is a slot index plus one, 0 is never valid. A table with a
+// genShift keeps the generation of the slot in the handle bits from genShift
+// up, and bumps it when the handle is released: a stale handle, e.g. the tag
+// of a detached event handler in an event the engine still delivers, is then
+// told apart from the handle the slot was reused for. The bits between
+// indexBits and genShift are left to the caller, e.g. for flags.
+//
+// All tables may be used from any goroutine, and so from any window thread.
+type handleTable struct {
+	mu    sync.RWMutex
+	slots []handleSlot
+	free  []uintptr
+	// bits of the slot index plus one, 0 for all of them
+	indexBits uint
+	// first bit of the generation, 0 for none
+	genShift uint
+}
+
+type handleSlot struct {
+	// nil for a free slot
+	v   interface{}
+	gen uintptr
+}
+
+func (t *handleTable) indexMask() uintptr {
+	if t.indexBits == 0 {
+		return ^uintptr(0)
+	}
+	return 1<<t.indexBits - 1
+}
+
+// add stores v, which must not be nil, and returns its handle
+func (t *handleTable) add(v interface{}) uintptr {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	var idx uintptr
+	if n := len(t.free); n > 0 {
+		idx = t.free[n-1]
+		t.free = t.free[:n-1]
+	} else {
+		if uintptr(len(t.slots)) == t.indexMask() {
+			log.Panic("handleTable: too many handles")
+		}
+		t.slots = append(t.slots, handleSlot{})
+		idx = uintptr(len(t.slots) - 1)
+	}
+	s := &t.slots[idx]
+	s.v = v
+	h := idx + 1
+	if t.genShift != 0 {
+		h |= s.gen << t.genShift
+	}
+	return h
+}
+
+// slot returns the slot of h, nil if h is released or stale; t must be locked
+func (t *handleTable) slot(h uintptr) *handleSlot {
+	idx := h&t.indexMask() - 1
+	if idx >= uintptr(len(t.slots)) {
+		return nil
+	}
+	s := &t.slots[idx]
+	if s.v == nil || (t.genShift != 0 && s.gen != h>>t.genShift) {
+		return nil
+	}
+	return s
+}
+
+// get returns the value of h, nil if h is released or stale
+func (t *handleTable) get(h uintptr) interface{} {
+	t.mu.RLock()
+	var v interface{}
+	if s := t.slot(h); s != nil {
+		v = s.v
+	}
+	t.mu.RUnlock()
+	return v
+}
+
+// remove releases h and returns its value, nil if h was already released or is stale
+func (t *handleTable) remove(h uintptr) interface{} {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	s := t.slot(h)
+	if s == nil {
+		return nil
+	}
+	v := s.v
+	s.v = nil
+	if t.genShift != 0 {
+		// the generation wraps around within the handle bits
+		s.gen = (s.gen + 1) & (^uintptr(0) >> t.genShift)
+	}
+	t.free = append(t.free, h&t.indexMask()-1)
+	return v
+}
@@ -0,0 +1,73 @@
+package sciter
+
+import (
+	"sync"
+	"testing"
+)
+
+func TestHandleTableReuse(t *testing.T) {
+	var table handleTable
+	a := table.add("a")
+	b := table.add("b")
+	if a == 0 || b == 0 || a == b {
+		t.Fatalf("handles %d and %d", a, b)
+	}
+	if v := table.remove(a); v != "a" {
+		t.Fatalf("remove returned %v", v)
+	}
+	if v := table.get(a); v != nil {
+		t.Fatalf("released handle returned %v", v)
+	}
+	if c := table.add("c"); c != a {
+		t.Fatalf("slot of %d not reused, got %d", a, c)
+	}
+	if len(table.slots) != 2 {
+		t.Fatalf("%d slots, want 2", len(table.slots))
+	}
+}
+
+func TestHandleTableGenerations(t *testing.T) {
+	table := handleTable{indexBits: 8, genShift: 9}
+	const flag = 1 << 8
+	h := table.add("old")
+	if v := table.get(h | flag); v != "old" {
+		t.Fatalf("flagged handle returned %v", v)
+	}
+	table.remove(h)
+	n := table.add("new")
+	if n == h {
+		t.Fatal("reused slot kept its generation")
+	}
+	if v := table.get(h); v != nil {
+		t.Fatalf("stale handle returned %v", v)
+	}
+	if v := table.remove(h); v != nil {
+		t.Fatalf("stale handle released %v", v)
+	}
+	if v := table.get(n); v != "new" {
+		t.Fatalf("new handle returned %v", v)
+	}
+}
+
+func TestHandleTableConcurrent(t *testing.T) {
+	var table handleTable
+	var wg sync.WaitGroup
+	for g := 0; g < 8; g++ {
+		wg.Add(1)
+		go func(g int) {
+			defer wg.Done()
+			for i := 0; i < 1000; i++ {
+				h := table.add(g)
+				if v := table.get(h); v != g {
+					t.Errorf("handle %d returned %v, want %d", h, v, g)
+					return
+				}
+				table.remove(h)
+			}
+		}(g)
+	}
+	wg.Wait()
+	if len(table.slots) > 8 {
+		t.Fatalf("%d slots for 8 goroutines", len(table.slots))
+	}
+}
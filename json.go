@@ -0,0 +1,239 @@
+package sciter
+
+/*
+#include "sciter-x.h"
+*/
+import "C"
+import (
+	"encoding/json"
+	"fmt"
+	"io"
+	"unsafe"
+)
+
+// size of the chunks WriteJSON moves through its buffer
+const jsonChunkSize = 32 * 1024
+
+// FromJSON parses a utf-8 JSON document into the Value in one ValueFromString call.
+// The document is transcoded straight into a single utf-16 buffer sized up front.
+func (pdst *Value) FromJSON(data []byte) error {
+	sc := newScratch()
+	// data is only read during the call, no need to copy it into a string
+	chars, numChars := sc.wstr(bytesToString(data))
+	err := pdst.fromJSON(chars, numChars)
+	sc.release()
+	return err
+}
+
+func (pdst *Value) fromJSON(chars C.LPCWSTR, numChars C.UINT) error {
+	cpdst := (*C.VALUE)(unsafe.Pointer(pdst))
+	// cgo call
+	r := C.ValueFromString(cpdst, chars, numChars, C.UINT(CVT_JSON_LITERAL))
+	// ret: number of characters left unparsed
+	if r != 0 {
+		return newValueError(HV_BAD_PARAMETER, fmt.Sprintf("ValueFromString: %d characters not parsed", r))
+	}
+	return nil
+}
+
+// ReadJSON parses the JSON document read from r into the Value incrementally.
+//
+// Unlike FromJSON, which hands the whole text to the engine in one go, the
+// document is tokenized in go (encoding/json.Decoder) and the Value is built
+// token by token: besides the Value itself only the decoder's read buffer and
+// one Value per open array or object are held, whatever the size of the input.
+// That costs a cgo call or two per token, so FromJSON remains the faster
+// choice for documents whose utf-16 text fits the memory budget.
+func (pdst *Value) ReadJSON(r io.Reader) error {
+	dec := json.NewDecoder(r)
+	dec.UseNumber()
+	var b jsonBuilder
+	defer b.clear()
+	for {
+		tok, err := dec.Token()
+		if err == io.EOF {
+			return newValueError(HV_BAD_PARAMETER, "ReadJSON: unexpected end of the document")
+		}
+		if err != nil {
+			return err
+		}
+		done, err := b.token(tok)
+		if err != nil {
+			return err
+		}
+		if done {
+			break
+		}
+	}
+	if _, err := dec.Token(); err != io.EOF {
+		return newValueError(HV_BAD_PARAMETER, "ReadJSON: data after the document")
+	}
+	return pdst.Copy(b.item)
+}
+
+// jsonBuilder builds a Value from the tokens of a JSON document
+type jsonBuilder struct {
+	// open arrays and objects, innermost last
+	stack []jsonFrame
+	// the value being stored, then the whole document
+	item *Value
+}
+
+type jsonFrame struct {
+	v      *Value
+	isMap  bool
+	n      int
+	key    *Value
+	hasKey bool
+}
+
+func (b *jsonBuilder) clear() {
+	for _, f := range b.stack {
+		f.v.clear()
+		if f.key != nil {
+			f.key.clear()
+		}
+	}
+	b.stack = nil
+	if b.item != nil {
+		b.item.clear()
+	}
+}
+
+// token adds tok to the Value, it returns true once the document is complete
+func (b *jsonBuilder) token(tok json.Token) (bool, error) {
+	if n := len(b.stack); n > 0 {
+		if f := &b.stack[n-1]; f.isMap && !f.hasKey && tok != json.Delim('}') {
+			f.hasKey = true
+			return false, f.key.SetString(tok.(string))
+		}
+	}
+	if b.item == nil {
+		b.item = newTempValue()
+	}
+	item := b.item
+	var err error
+	switch t := tok.(type) {
+	case json.Delim:
+		switch t {
+		case '{', '[':
+			f := jsonFrame{v: newTempValue(), isMap: t == '{'}
+			if f.isMap {
+				f.key = newTempValue()
+				err = f.v.ConvertFromString("{}", CVT_JSON_LITERAL)
+			} else {
+				err = f.v.AppendSlice([]*Value{})
+			}
+			b.stack = append(b.stack, f)
+			return false, err
+		}
+		// end of the innermost array or object, which is stored into its parent
+		f := b.stack[len(b.stack)-1]
+		b.stack = b.stack[:len(b.stack)-1]
+		if f.key != nil {
+			f.key.clear()
+		}
+		item.clear()
+		*item = *f.v
+	case string:
+		err = item.SetString(t)
+	case json.Number:
+		if i, e := t.Int64(); e == nil && int64(int32(i)) == i {
+			err = item.SetInt(int(i))
+		} else {
+			var f float64
+			if f, err = t.Float64(); err == nil {
+				err = item.SetFloat(f)
+			}
+		}
+	case bool:
+		err = item.SetBool(t)
+	case nil:
+		item.t = T_NULL
+	}
+	if err != nil {
+		return false, err
+	}
+	n := len(b.stack)
+	if n == 0 {
+		return true, nil
+	}
+	f := &b.stack[n-1]
+	cparent := (*C.VALUE)(unsafe.Pointer(f.v))
+	citem := (*C.VALUE)(unsafe.Pointer(item))
+	if f.isMap {
+		f.hasKey = false
+		// cgo call
+		r := C.ValueSetValueToKey(cparent, (*C.VALUE)(unsafe.Pointer(f.key)), citem)
+		err = wrapValueResult(VALUE_RESULT(r), "ValueSetValueToKey")
+		f.key.clear()
+	} else {
+		// cgo call
+		r := C.ValueNthElementValueSet(cparent, C.INT(f.n), citem)
+		err = wrapValueResult(VALUE_RESULT(r), "ValueNthElementValueSet")
+		f.n++
+	}
+	item.clear()
+	return false, err
+}
+
+// jsonString converts a copy of the Value to its JSON text and passes the utf-16 words to fn.
+// The words are only valid during fn.
+func (pdst *Value) jsonString(fn func(us []uint16) error) error {
+	var t Value
+	t.init()
+	defer t.clear()
+	if err := t.Copy(pdst); err != nil {
+		return err
+	}
+	if err := t.ConvertToString(CVT_JSON_LITERAL); err != nil {
+		return err
+	}
+	// args
+	ct := (*C.VALUE)(unsafe.Pointer(&t))
+	var chars C.LPCWSTR
+	var numChars C.UINT
+	// cgo call
+	r := C.ValueStringData(ct, &chars, &numChars)
+	if err := wrapValueResult(VALUE_RESULT(r), "ValueStringData"); err != nil {
+		return err
+	}
+	if numChars == 0 {
+		return fn(nil)
+	}
+	return fn(utf16Slice((*uint16)(unsafe.Pointer(chars)), int(numChars)))
+}
+
+// MarshalJSON returns the Value as a utf-8 JSON document, see CVT_JSON_LITERAL.
+// It also makes *Value an encoding/json Marshaler.
+func (pdst *Value) MarshalJSON() ([]byte, error) {
+	var data []byte
+	err := pdst.jsonString(func(us []uint16) error {
+		data = appendUtf8(nil, us)
+		return nil
+	})
+	return data, err
+}
+
+// WriteJSON is MarshalJSON writing to w in chunks through one reused buffer,
+// without building the utf-8 document in memory.
+func (pdst *Value) WriteJSON(w io.Writer) error {
+	return pdst.jsonString(func(us []uint16) error {
+		buf := make([]byte, 0, 3*jsonChunkSize)
+		for len(us) > 0 {
+			n := jsonChunkSize
+			if n >= len(us) {
+				n = len(us)
+			} else if us[n-1] >= 0xd800 && us[n-1] < 0xdc00 {
+				// do not split a surrogate pair
+				n--
+			}
+			buf = appendUtf8(buf[:0], us[:n])
+			if _, err := w.Write(buf); err != nil {
+				return err
+			}
+			us = us[n:]
+		}
+		return nil
+	})
+}
@@ -0,0 +1,124 @@
+package sciter
+
+import (
+	"bytes"
+	"encoding/json"
+	"fmt"
+	"testing"
+)
+
+type benchRecord struct {
+	ID    int      `json:"id" sciter:"id"`
+	Name  string   `json:"name" sciter:"name"`
+	Price float64  `json:"price" sciter:"price"`
+	OK    bool     `json:"ok" sciter:"ok"`
+	Tags  []string `json:"tags" sciter:"tags"`
+}
+
+// benchRecords returns records whose JSON text takes about size bytes
+func benchRecords(size int) []benchRecord {
+	var records []benchRecord
+	for n := 2; n < size; {
+		r := benchRecord{
+			ID:    len(records),
+			Name:  fmt.Sprintf("item %d", len(records)),
+			Price: float64(len(records)) * 1.25,
+			OK:    len(records)%2 == 0,
+			Tags:  []string{"a", "b"},
+		}
+		data, _ := json.Marshal(r)
+		n += len(data) + 1
+		records = append(records, r)
+	}
+	return records
+}
+
+// buildTree builds the Value of records the way it is done without the bridge,
+// one Set or Append at a time
+func buildTree(records []benchRecord) *Value {
+	root := NewValue()
+	for _, r := range records {
+		item := NewValue()
+		item.Set("id", r.ID)
+		item.Set("name", r.Name)
+		item.Set("price", r.Price)
+		item.Set("ok", r.OK)
+		tags := NewValue()
+		for _, t := range r.Tags {
+			tags.Append(t)
+		}
+		item.Set("tags", tags)
+		root.Append(item)
+	}
+	return root
+}
+
+func BenchmarkJSON(b *testing.B) {
+	for _, size := range []struct {
+		name  string
+		bytes int
+	}{
+		{"1KB", 1 << 10},
+		{"1MB", 1 << 20},
+		{"50MB", 50 << 20},
+	} {
+		b.Run(size.name, func(b *testing.B) {
+			requireEngine(b)
+			records := benchRecords(size.bytes)
+			data, err := json.Marshal(records)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.Run("tree", func(b *testing.B) {
+				b.SetBytes(int64(len(data)))
+				for i := 0; i < b.N; i++ {
+					buildTree(records).Release()
+				}
+			})
+			b.Run("Marshal", func(b *testing.B) {
+				b.SetBytes(int64(len(data)))
+				for i := 0; i < b.N; i++ {
+					v, err := Marshal(records)
+					if err != nil {
+						b.Fatal(err)
+					}
+					v.Release()
+				}
+			})
+			b.Run("FromJSON", func(b *testing.B) {
+				b.SetBytes(int64(len(data)))
+				for i := 0; i < b.N; i++ {
+					v := NewValue()
+					if err := v.FromJSON(data); err != nil {
+						b.Fatal(err)
+					}
+					v.Release()
+				}
+			})
+			b.Run("ReadJSON", func(b *testing.B) {
+				b.SetBytes(int64(len(data)))
+				for i := 0; i < b.N; i++ {
+					v := NewValue()
+					if err := v.ReadJSON(bytes.NewReader(data)); err != nil {
+						b.Fatal(err)
+					}
+					v.Release()
+				}
+			})
+			b.Run("MarshalJSON", func(b *testing.B) {
+				v := NewValue()
+				defer v.Release()
+				if err := v.FromJSON(data); err != nil {
+					b.Fatal(err)
+				}
+				b.SetBytes(int64(len(data)))
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					if _, err := v.MarshalJSON(); err != nil {
+						b.Fatal(err)
+					}
+				}
+			})
+		})
+	}
+}
@@ -0,0 +1,55 @@
+#include "nodewalk.h"
+
+// Walks the subtree of root in pre-order and stores up to cap items.
+// *pcount receives the number of nodes in the subtree, which may exceed cap:
+// the caller then retries with a larger array.
+SCDOM_RESULT NodeWalk( HNODE root, NODE_WALK_ITEM* items, UINT cap, UINT* pcount )
+{
+  UINT count = 0;
+  UINT depth = 0;
+  // index of the parent of cur, only meaningful while items are stored:
+  // the ancestors of a stored item are stored too
+  INT parent = -1;
+  HNODE cur = root;
+  *pcount = 0;
+  for(;;) {
+    UINT type = NT_ELEMENT;
+    SCDOM_RESULT r = SciterNodeType(cur, &type);
+    if( r != SCDOM_OK )
+      return r;
+    INT index = (INT)count;
+    if( count < cap ) {
+      items[count].hn = cur;
+      items[count].type = type;
+      items[count].depth = depth;
+      items[count].parent = parent;
+    }
+    *pcount = ++count;
+
+    HNODE next = 0;
+    if( type == NT_ELEMENT && SciterNodeFirstChild(cur, &next) == SCDOM_OK && next ) {
+      parent = index;
+      ++depth;
+      cur = next;
+      continue;
+    }
+    // no children: on to the next sibling of cur or of its closest ancestor having one
+    for(;;) {
+      if( depth == 0 )
+        return SCDOM_OK;
+      next = 0;
+      if( SciterNodeNextSibling(cur, &next) == SCDOM_OK && next ) {
+        cur = next;
+        break;
+      }
+      HELEMENT he = 0;
+      r = SciterNodeParent(cur, &he);
+      if( r == SCDOM_OK )
+        r = SciterNodeCastFromElement(he, &cur);
+      if( r != SCDOM_OK )
+        return r;
+      --depth;
+      parent = (parent >= 0 && (UINT)parent < cap) ? items[parent].parent : -1;
+    }
+  }
+}
@@ -0,0 +1,62 @@
+package sciter
+
+/*
+#include "nodewalk.h"
+*/
+import "C"
+import "unsafe"
+
+// NodeWalkItem is a node of a subtree flattened by Node.Walk.
+// Its layout matches NODE_WALK_ITEM (nodewalk.h).
+type NodeWalkItem struct {
+	handle C.HNODE
+	Type   NODE_TYPE
+	// 0 for the root of the walk
+	Depth uint32
+	// index of the parent item, -1 for the root
+	Parent int32
+}
+
+// Node wraps the item, the result stays valid after the tree changes
+func (it *NodeWalkItem) Node() *Node {
+	return WrapNode(it.handle)
+}
+
+// Walk flattens the subtree of the node, the node included, in pre-order.
+//
+// The whole walk is a single cgo call (nodewalk.c), so indexing or searching
+// a large document does not pay a crossing and a wrapper per node; wrap only
+// the items of interest with NodeWalkItem.Node. The items themselves hold no
+// reference and must not be used once the tree is modified.
+//
+// buf is reused when large enough, pass nil to allocate.
+func (n *Node) Walk(buf []NodeWalkItem) ([]NodeWalkItem, error) {
+	buf = buf[:cap(buf)]
+	if len(buf) == 0 {
+		buf = make([]NodeWalkItem, 64)
+	}
+	for {
+		// args
+		var ccount C.UINT
+		citems := (*C.NODE_WALK_ITEM)(unsafe.Pointer(&buf[0]))
+		// cgo call
+		r := C.NodeWalk(n.handle, citems, C.UINT(len(buf)), &ccount)
+		if err := wrapDomResult(r, "NodeWalk"); err != nil {
+			return buf[:0], err
+		}
+		if int(ccount) <= len(buf) {
+			return buf[:ccount], nil
+		}
+		// the subtree did not fit, walk again with room for all of it
+		buf = make([]NodeWalkItem, ccount)
+	}
+}
+
+// Walk flattens the subtree of the element, see Node.Walk
+func (e *Element) Walk(buf []NodeWalkItem) ([]NodeWalkItem, error) {
+	n, err := e.Node()
+	if err != nil {
+		return buf[:0], err
+	}
+	return n.Walk(buf)
+}
@@ -0,0 +1,18 @@
+#ifndef NODEWALK_H
+#define NODEWALK_H
+
+#include "sciter-x.h"
+
+// One node of a subtree flattened by NodeWalk, shared by nodewalk.go and nodewalk.c.
+// The handle is borrowed: it is not AddRef'ed and stays valid only while the
+// tree is not modified.
+typedef struct {
+  HNODE hn;
+  UINT  type;   // NODE_TYPE
+  UINT  depth;  // 0 for the root of the walk
+  INT   parent; // index of the parent item, -1 for the root
+} NODE_WALK_ITEM;
+
+SCDOM_RESULT NodeWalk( HNODE root, NODE_WALK_ITEM* items, UINT cap, UINT* pcount );
+
+#endif
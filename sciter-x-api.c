@@ -398,6 +398,7 @@ ISciterAPI *_SAPI(ISciterAPI *ext) {
  HSARCHIVE SCAPI SciterOpenArchive (LPCBYTE archiveData, UINT archiveDataLength) { return SAPI()->SciterOpenArchive (archiveData,archiveDataLength); }
  SBOOL SCAPI SciterGetArchiveItem (HSARCHIVE harc, LPCWSTR path, LPCBYTE* pdata, UINT* pdataLength){ return SAPI()->SciterGetArchiveItem (harc,path,pdata,pdataLength); }
  SBOOL SCAPI SciterCloseArchive (HSARCHIVE harc) { return SAPI()->SciterCloseArchive(harc); }
+ UINT_PTR SCAPI SciterPostCallback (HWINDOW hwnd, UINT_PTR wparam, UINT_PTR lparam, UINT timeoutms) { return SAPI()->SciterPostCallback(hwnd,wparam,lparam,timeoutms); }
 
 #if defined(WINDOWS) && !defined(WINDOWLESS)
   SBOOL SCAPI SciterCreateOnDirectXWindow(HWINDOW hwnd, IUnknown* pSwapChain) { return SAPI()->SciterCreateOnDirectXWindow(hwnd,pSwapChain); }
@@ -0,0 +1,93 @@
+package sciter
+
+import (
+	"os"
+	"path/filepath"
+	"runtime"
+	"strings"
+	"sync"
+	"testing"
+	"unsafe"
+)
+
+var engine struct {
+	sync.Once
+	found bool
+}
+
+// requireEngine skips tests and benchmarks that call into the Sciter library
+// when it cannot be found: loading it (see _SAPI in sciter-x-api.c) exits the
+// process on failure.
+func requireEngine(tb testing.TB) {
+	engine.Do(func() {
+		engine.found = findEngine()
+	})
+	if !engine.found {
+		tb.Skip("Sciter library not found")
+	}
+}
+
+func findEngine() bool {
+	name := "libsciter-gtk.so"
+	switch runtime.GOOS {
+	case "windows":
+		name = "sciter.dll"
+	case "darwin":
+		name = "libsciter.dylib"
+	}
+	var dirs []string
+	if exe, err := os.Executable(); err == nil {
+		dirs = append(dirs, filepath.Dir(exe))
+	}
+	for _, env := range []string{"LD_LIBRARY_PATH", "DYLD_LIBRARY_PATH", "PATH"} {
+		dirs = append(dirs, strings.Split(os.Getenv(env), string(os.PathListSeparator))...)
+	}
+	dirs = append(dirs, "/usr/lib", "/usr/local/lib", "/usr/lib/x86_64-linux-gnu")
+	for _, dir := range dirs {
+		if dir == "" {
+			continue
+		}
+		if _, err := os.Stat(filepath.Join(dir, name)); err == nil {
+			return true
+		}
+	}
+	return false
+}
+
+func TestDroppedPerEvent(t *testing.T) {
+	var params TimerParams
+	var tag uintptr
+	var outer, inner int
+	handler := &EventHandler{
+		OnTimer: func(he *Element, p *TimerParams) bool {
+			if he.Dropped() == 3 {
+				// a nested dispatch to the same handler
+				goElementEventProc(tag, nil, HANDLE_TIMER, unsafe.Pointer(&params), 0)
+				outer = he.Dropped()
+			} else {
+				inner = he.Dropped()
+			}
+			return false
+		},
+	}
+	tag = registerEventHandler(handler, false)
+	defer releaseEventHandler(tag)
+	goElementEventProc(tag, nil, HANDLE_TIMER, unsafe.Pointer(&params), 3)
+	if outer != 3 || inner != 0 {
+		t.Errorf("outer event saw %d dropped, inner %d; want 3 and 0", outer, inner)
+	}
+}
+
+func TestStaleFunctorInvoke(t *testing.T) {
+	requireEngine(t)
+	tag := functors.add(NativeFunctor(func(args ...*Value) *Value {
+		return NewValue(1)
+	}))
+	functors.remove(tag)
+	retval := newTempValue()
+	defer retval.clear()
+	goNATIVE_FUNCTOR_INVOKE(tag, 0, nil, unsafe.Pointer(retval))
+	if !retval.IsString() || retval.String() != "native function was released" {
+		t.Errorf("stale functor returned %v", retval)
+	}
+}
@@ -1,81 +1,278 @@
-package sciter
-
-/*
-#cgo CFLAGS: -Iinclude
-#include "sciter-x.h"
-*/
-import "C"
-import (
-	"syscall"
-	"unicode/utf16"
-	"unsafe"
-)
-
-// Returns the utf-8 encoding of the utf-16 sequence s,
-// with a terminating NUL removed.
-func Utf16ToString(s *uint16) string {
-	if s == nil {
-		panic("null cstring")
-	}
-	us := make([]uint16, 0, 256)
-	for p := uintptr(unsafe.Pointer(s)); ; p += 2 {
-		u := *(*uint16)(unsafe.Pointer(p))
-		if u == 0 {
-			return string(utf16.Decode(us))
-		}
-		us = append(us, u)
-	}
-	return ""
-}
-
-func Utf16ToStringLength(s *uint16, length int) string {
-	if s == nil {
-		panic("null cstring")
-	}
-	us := make([]uint16, 0, 256)
-	for p, i := uintptr(unsafe.Pointer(s)), 0; i < length; p, i = p+2, i+1 {
-		u := *(*uint16)(unsafe.Pointer(p))
-		us = append(us, u)
-	}
-	return string(utf16.Decode(us))
-}
-
-func StringToBytePtr(s string) *byte {
-	bs := ([]byte)(s)
-	return &bs[0]
-}
-
-// returns a UTF-16 string, including the trailing zero
-func Utf16FromString(s string) ([]uint16, error) {
-	for i := 0; i < len(s); i++ {
-		if s[i] == 0 {
-			return nil, syscall.EINVAL
-		}
-	}
-	return utf16.Encode([]rune(s + "\x00")), nil
-}
-
-func StringToWcharPtr(s string) *C.WCHAR {
-	return (*C.WCHAR)(unsafe.Pointer(StringToUTF16Ptr(s)))
-}
-
-func StringToUTF16Ptr(s string) *uint16 {
-	us, _ := Utf16FromString(s)
-	return &us[0]
-}
-
-func StringToUTF16PtrWithLen(s string) (*uint16, int) {
-	us, _ := Utf16FromString(s)
-	length := len(us) - 1
-	return &us[0], length
-}
-
-func ByteCPtrToBytes(bp C.LPCBYTE, size C.UINT) []byte {
-	bs := C.GoBytes(unsafe.Pointer(bp), C.INT(size))
-	return bs
-}
-
-func BytePtrToBytes(bp *byte, size uint) []byte {
-	bs := C.GoBytes(unsafe.Pointer(bp), C.INT(size))
-	return bs
-}
+package sciter
+
+/*
+#cgo CFLAGS: -Iinclude
+#include "sciter-x.h"
+*/
+import "C"
+import (
+	"reflect"
+	"sync"
+	"syscall"
+	"unicode/utf16"
+	"unicode/utf8"
+	"unsafe"
+)
+
+// Returns the utf-8 encoding of the utf-16 sequence s,
+// with a terminating NUL removed.
+func Utf16ToString(s *uint16) string {
+	if s == nil {
+		panic("null cstring")
+	}
+	return decodeUtf16(utf16Slice(s, utf16Len(s)))
+}
+
+// Returns the utf-8 encoding of the first length utf-16 words at s.
+// No NUL scan is done, so callers that already know the length
+// (e.g. LPCWSTR_RECEIVER, ValueStringData) should prefer it.
+func Utf16ToStringLength(s *uint16, length int) string {
+	if length <= 0 {
+		return ""
+	}
+	if s == nil {
+		panic("null cstring")
+	}
+	return decodeUtf16(utf16Slice(s, length))
+}
+
+// views n utf-16 words starting at s without copying
+func utf16Slice(s *uint16, n int) []uint16 {
+	var us []uint16
+	// a slice header rather than a big array type, which does not fit 32-bit targets
+	h := (*reflect.SliceHeader)(unsafe.Pointer(&us))
+	h.Data = uintptr(unsafe.Pointer(s))
+	h.Len = n
+	h.Cap = n
+	return us
+}
+
+// number of utf-16 words before the terminating NUL
+func utf16Len(s *uint16) int {
+	us := (*[1 << 28]uint16)(unsafe.Pointer(s))
+	n := 0
+	for us[n] != 0 {
+		n++
+	}
+	return n
+}
+
+// decodeUtf16 converts utf-16 words to a go string with a single allocation.
+func decodeUtf16(us []uint16) string {
+	return bytesToString(appendUtf8(nil, us))
+}
+
+// appendUtf8 appends the utf-8 encoding of the utf-16 words us to dst,
+// growing it at most once. Pure ASCII input (the common case for attributes,
+// styles and urls) is detected four words at a time and narrowed directly;
+// anything else is sized first and then encoded in place, with Latin-1 taking
+// the short two byte branch. Unpaired surrogates become U+FFFD as in utf16.Decode.
+func appendUtf8(dst []byte, us []uint16) []byte {
+	n := len(us)
+	i := 0
+	for ; i+4 <= n; i += 4 {
+		if (us[i]|us[i+1]|us[i+2]|us[i+3])&0xff80 != 0 {
+			break
+		}
+	}
+	for ; i < n && us[i] < 0x80; i++ {
+	}
+	// ascii prefix is copied as is, the rest is sized before encoding
+	size := i
+	for j := i; j < n; j++ {
+		u := us[j]
+		switch {
+		case u < 0x80:
+			size++
+		case u < 0x800:
+			size += 2
+		case utf16.IsSurrogate(rune(u)) && u < 0xdc00 && j+1 < n && us[j+1] >= 0xdc00 && us[j+1] < 0xe000:
+			size += 4
+			j++
+		default:
+			size += 3
+		}
+	}
+	start := len(dst)
+	if cap(dst)-start < size {
+		grown := make([]byte, start, start+size)
+		copy(grown, dst)
+		dst = grown
+	}
+	dst = dst[:start+size]
+	bs := dst[start:]
+	for j := 0; j < i; j++ {
+		bs[j] = byte(us[j])
+	}
+	k := i
+	for j := i; j < n; j++ {
+		u := us[j]
+		switch {
+		case u < 0x80:
+			bs[k] = byte(u)
+			k++
+		case u < 0x800:
+			bs[k] = 0xc0 | byte(u>>6)
+			bs[k+1] = 0x80 | byte(u)&0x3f
+			k += 2
+		case utf16.IsSurrogate(rune(u)):
+			r := utf8.RuneError
+			if u < 0xdc00 && j+1 < n && us[j+1] >= 0xdc00 && us[j+1] < 0xe000 {
+				r = utf16.DecodeRune(rune(u), rune(us[j+1]))
+				j++
+			}
+			k += utf8.EncodeRune(bs[k:], r)
+		default:
+			bs[k] = 0xe0 | byte(u>>12)
+			bs[k+1] = 0x80 | byte(u>>6)&0x3f
+			bs[k+2] = 0x80 | byte(u)&0x3f
+			k += 3
+		}
+	}
+	return dst
+}
+
+// bytesToString hands over a freshly made []byte as a string without copying,
+// bs must not be modified afterwards.
+func bytesToString(bs []byte) string {
+	return *(*string)(unsafe.Pointer(&bs))
+}
+
+func StringToBytePtr(s string) *byte {
+	bs := ([]byte)(s)
+	return &bs[0]
+}
+
+// returns a UTF-16 string, including the trailing zero
+func Utf16FromString(s string) ([]uint16, error) {
+	for i := 0; i < len(s); i++ {
+		if s[i] == 0 {
+			return nil, syscall.EINVAL
+		}
+	}
+	return appendUtf16(make([]uint16, 0, len(s)+1), s), nil
+}
+
+func StringToWcharPtr(s string) *C.WCHAR {
+	return (*C.WCHAR)(unsafe.Pointer(StringToUTF16Ptr(s)))
+}
+
+func StringToUTF16Ptr(s string) *uint16 {
+	us, _ := Utf16FromString(s)
+	return &us[0]
+}
+
+func StringToUTF16PtrWithLen(s string) (*uint16, int) {
+	us, _ := Utf16FromString(s)
+	length := len(us) - 1
+	return &us[0], length
+}
+
+// appendUtf16 appends the utf-16 encoding of s and a terminating NUL to dst.
+// A utf-8 string never needs more than len(s)+1 words, so callers that
+// reserve that much get the whole conversion without reallocation.
+func appendUtf16(dst []uint16, s string) []uint16 {
+	for i := 0; i < len(s); {
+		if c := s[i]; c < utf8.RuneSelf {
+			dst = append(dst, uint16(c))
+			i++
+			continue
+		}
+		r, size := utf8.DecodeRuneInString(s[i:])
+		if r >= 0x10000 {
+			r1, r2 := utf16.EncodeRune(r)
+			dst = append(dst, uint16(r1), uint16(r2))
+		} else {
+			dst = append(dst, uint16(r))
+		}
+		i += size
+	}
+	return append(dst, 0)
+}
+
+// scratch holds reusable buffers for the strings handed to a single cgo call.
+// Get one with newScratch() and release() it as soon as the call returns:
+// the engine copies whatever it keeps, so the buffers are free to be reused.
+type scratch struct {
+	u16 []uint16
+	u8  []byte
+}
+
+const (
+	// larger buffers (e.g. from Eval of a big script) are not pooled
+	maxScratchSize = 64 * 1024
+)
+
+var (
+	scratchPool = sync.Pool{
+		New: func() interface{} {
+			return &scratch{
+				u16: make([]uint16, 0, 256),
+				u8:  make([]byte, 0, 64),
+			}
+		},
+	}
+)
+
+func newScratch() *scratch {
+	return scratchPool.Get().(*scratch)
+}
+
+func (s *scratch) release() {
+	if cap(s.u16) > maxScratchSize || cap(s.u8) > maxScratchSize {
+		return
+	}
+	s.u16 = s.u16[:0]
+	s.u8 = s.u8[:0]
+	scratchPool.Put(s)
+}
+
+// wstr encodes str as NUL terminated utf-16 into the scratch buffer,
+// returning the string and its length in words without the NUL.
+func (s *scratch) wstr(str string) (C.LPCWSTR, C.UINT) {
+	start := len(s.u16)
+	if cap(s.u16)-start < len(str)+1 {
+		// earlier strings stay valid in the old array
+		s.u16 = make([]uint16, 0, 2*cap(s.u16)+len(str)+1)
+		start = 0
+	}
+	s.u16 = appendUtf16(s.u16, str)
+	return C.LPCWSTR(unsafe.Pointer(&s.u16[start])), C.UINT(len(s.u16) - start - 1)
+}
+
+// cstr copies str as NUL terminated utf-8 into the scratch buffer.
+func (s *scratch) cstr(str string) C.LPCSTR {
+	start := len(s.u8)
+	if cap(s.u8)-start < len(str)+1 {
+		s.u8 = make([]byte, 0, 2*cap(s.u8)+len(str)+1)
+		start = 0
+	}
+	s.u8 = append(append(s.u8, str...), 0)
+	return C.LPCSTR(unsafe.Pointer(&s.u8[start]))
+}
+
+func ByteCPtrToBytes(bp C.LPCBYTE, size C.UINT) []byte {
+	bs := C.GoBytes(unsafe.Pointer(bp), C.INT(size))
+	return bs
+}
+
+func BytePtrToBytes(bp *byte, size uint) []byte {
+	bs := C.GoBytes(unsafe.Pointer(bp), C.INT(size))
+	return bs
+}
+
+// BytePtrView returns the size bytes at bp as a slice without copying them.
+// The slice borrows engine memory: it is only valid as long as the owner of
+// that memory (the callback or the Value it came from) is, and must not be
+// appended to. Copy it, e.g. with append([]byte(nil), view...), to keep it.
+func BytePtrView(bp *byte, size uint) []byte {
+	if bp == nil || size == 0 {
+		return nil
+	}
+	var bs []byte
+	h := (*reflect.SliceHeader)(unsafe.Pointer(&bs))
+	h.Data = uintptr(unsafe.Pointer(bp))
+	h.Len = int(size)
+	h.Cap = int(size)
+	return bs
+}
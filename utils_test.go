@@ -0,0 +1,102 @@
+package sciter
+
+import (
+	"testing"
+	"unicode/utf16"
+)
+
+var benchStrings = []struct {
+	name string
+	s    string
+}{
+	{"ascii", "div.item > span[name=title]:hover"},
+	{"latin1", "café crème brûlée à la carte"},
+	{"cjk", "選択された要素のスタイル属性"},
+	{"emoji", "status: 🙂 ok 🚀 done"},
+}
+
+func TestAppendUtf16(t *testing.T) {
+	for _, c := range benchStrings {
+		want := utf16.Encode([]rune(c.s + "\x00"))
+		got := appendUtf16(nil, c.s)
+		if len(got) != len(want) {
+			t.Fatalf("%s: %d words, want %d", c.name, len(got), len(want))
+		}
+		for i := range got {
+			if got[i] != want[i] {
+				t.Fatalf("%s: word %d is %#x, want %#x", c.name, i, got[i], want[i])
+			}
+		}
+	}
+}
+
+func TestScratchAllocs(t *testing.T) {
+	for _, c := range benchStrings {
+		allocs := testing.AllocsPerRun(100, func() {
+			sc := newScratch()
+			sc.wstr(c.s)
+			sc.cstr(c.s)
+			sc.release()
+		})
+		if allocs != 0 {
+			t.Errorf("%s: %v allocations per call, want 0", c.name, allocs)
+		}
+	}
+}
+
+func TestDecodeUtf16(t *testing.T) {
+	for _, c := range []struct {
+		name string
+		us   []uint16
+	}{
+		{"empty", []uint16{}},
+		{"ascii", utf16.Encode([]rune("div.item > span"))},
+		{"ascii tail", utf16.Encode([]rune("abcdefg"))},
+		{"latin1", utf16.Encode([]rune("café crème"))},
+		{"bmp", utf16.Encode([]rune("選択された要素"))},
+		{"pairs", utf16.Encode([]rune("ok 🙂🚀 done"))},
+		{"lone high", []uint16{'a', 0xd83d, 'b'}},
+		{"lone low", []uint16{'a', 0xde42, 'b'}},
+		{"swapped pair", []uint16{0xde42, 0xd83d, 'x'}},
+		{"pair split at the end", []uint16{'a', 'b', 'c', 'd', 0xd83d}},
+		{"low at the end", []uint16{0xde42}},
+	} {
+		want := string(utf16.Decode(c.us))
+		if got := decodeUtf16(c.us); got != want {
+			t.Errorf("%s: decodeUtf16 = %q, want %q", c.name, got, want)
+		}
+		if got := string(appendUtf8([]byte("prefix:"), c.us)); got != "prefix:"+want {
+			t.Errorf("%s: appendUtf8 = %q, want %q", c.name, got, "prefix:"+want)
+		}
+	}
+}
+
+// the conversion outbound strings went through before the scratch buffers
+func legacyUtf16(s string) []uint16 {
+	return utf16.Encode([]rune(s + "\x00"))
+}
+
+func BenchmarkUtf16Encode(b *testing.B) {
+	for _, c := range benchStrings {
+		b.Run(c.name+"/legacy", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				legacyUtf16(c.s)
+			}
+		})
+		b.Run(c.name+"/Utf16FromString", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				Utf16FromString(c.s)
+			}
+		})
+		b.Run(c.name+"/scratch", func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				sc := newScratch()
+				sc.wstr(c.s)
+				sc.release()
+			}
+		})
+	}
+}
@@ -0,0 +1,185 @@
+#include "sciter-x.h"
+
+// Bulk array helpers for value.go.
+// Each of them builds or reads a whole array in one call, so Go pays a single
+// cgo crossing instead of one (plus a finalized temporary) per element.
+
+static const WCHAR EMPTY_ARRAY[] = { '[', ']', 0 };
+
+// an undefined VALUE becomes an empty array, so that appending nothing still
+// yields [] as NewValueFromSlice([]int{}) is expected to
+static UINT array_prepare( VALUE* pval, INT* pstart )
+{
+  UINT t = 0, u = 0;
+  ValueType(pval, &t, &u);
+  if( t == T_UNDEFINED ) {
+    *pstart = 0;
+    return ValueFromString(pval, EMPTY_ARRAY, 2, CVT_JSON_LITERAL);
+  }
+  return ValueElementsCount(pval, pstart);
+}
+
+UINT ValueArrayAppendInts( VALUE* pval, const INT* items, UINT n )
+{
+  INT start = 0;
+  UINT r = array_prepare(pval, &start);
+  for( UINT i = 0; r == HV_OK && i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    ValueIntDataSet(&t, items[i], T_INT, 0);
+    r = ValueNthElementValueSet(pval, start + i, &t);
+    ValueClear(&t);
+  }
+  return r;
+}
+
+UINT ValueArrayAppendFloats( VALUE* pval, const FLOAT_VALUE* items, UINT n )
+{
+  INT start = 0;
+  UINT r = array_prepare(pval, &start);
+  for( UINT i = 0; r == HV_OK && i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    ValueFloatDataSet(&t, items[i], T_FLOAT, 0);
+    r = ValueNthElementValueSet(pval, start + i, &t);
+    ValueClear(&t);
+  }
+  return r;
+}
+
+// chars holds n NUL terminated strings back to back, lengths exclude the NUL
+UINT ValueArrayAppendStrings( VALUE* pval, LPCWSTR chars, const UINT* lengths, UINT n )
+{
+  INT start = 0;
+  UINT r = array_prepare(pval, &start);
+  for( UINT i = 0; r == HV_OK && i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    ValueStringDataSet(&t, chars, lengths[i], UT_STRING_STRING);
+    r = ValueNthElementValueSet(pval, start + i, &t);
+    ValueClear(&t);
+    chars += lengths[i] + 1;
+  }
+  return r;
+}
+
+// items are borrowed, the array takes its own references
+UINT ValueArrayAppendValues( VALUE* pval, const VALUE* items, UINT n )
+{
+  INT start = 0;
+  UINT r = array_prepare(pval, &start);
+  for( UINT i = 0; r == HV_OK && i < n; ++i )
+    r = ValueNthElementValueSet(pval, start + i, &items[i]);
+  return r;
+}
+
+UINT ValueArrayGetInts( const VALUE* pval, INT* out, UINT n )
+{
+  for( UINT i = 0; i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    out[i] = 0;
+    if( ValueNthElementValue(pval, i, &t) == HV_OK )
+      ValueIntData(&t, &out[i]);
+    ValueClear(&t);
+  }
+  return HV_OK;
+}
+
+UINT ValueArrayGetFloats( const VALUE* pval, FLOAT_VALUE* out, UINT n )
+{
+  for( UINT i = 0; i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    out[i] = 0;
+    if( ValueNthElementValue(pval, i, &t) == HV_OK )
+      ValueFloatData(&t, &out[i]);
+    ValueClear(&t);
+  }
+  return HV_OK;
+}
+
+// Receives pointers to the string data of the elements.
+// The array keeps its own reference to every string, so the chars stay valid
+// while pval is alive and unmodified. Non-string elements get NULL.
+UINT ValueArrayGetStrings( const VALUE* pval, LPCWSTR* chars, UINT* lengths, UINT n )
+{
+  for( UINT i = 0; i < n; ++i ) {
+    VALUE t;
+    ValueInit(&t);
+    chars[i] = NULL;
+    lengths[i] = 0;
+    if( ValueNthElementValue(pval, i, &t) == HV_OK && t.t == T_STRING )
+      ValueStringData(&t, &chars[i], &lengths[i]);
+    ValueClear(&t);
+  }
+  return HV_OK;
+}
+
+// out must be n uninitialized VALUEs, the caller owns them afterwards
+UINT ValueArrayGetValues( const VALUE* pval, VALUE* out, UINT n )
+{
+  for( UINT i = 0; i < n; ++i ) {
+    ValueInit(&out[i]);
+    ValueNthElementValue(pval, i, &out[i]);
+  }
+  return HV_OK;
+}
+
+typedef struct {
+  VALUE* out;
+  UINT   n;
+  UINT   count;
+} entries_ctx;
+
+static SBOOL SC_CALLBACK entries_cb( LPVOID param, const VALUE* pkey, const VALUE* pval )
+{
+  entries_ctx* ctx = (entries_ctx*)param;
+  if( ctx->count >= ctx->n )
+    return FALSE;
+  VALUE* slot = ctx->out + ctx->count * 2;
+  ValueInit(&slot[0]);
+  ValueInit(&slot[1]);
+  ValueCopy(&slot[0], pkey);
+  ValueCopy(&slot[1], pval);
+  ++ctx->count;
+  return TRUE;
+}
+
+// Copies up to n key/value pairs of a T_MAP, T_FUNCTION or T_OBJECT into out,
+// laid out as key0, val0, key1, val1, ... (2*n uninitialized VALUEs).
+// *pcount receives the number of pairs written, the caller owns them afterwards.
+UINT ValueMapGetEntries( const VALUE* pval, VALUE* out, UINT n, UINT* pcount )
+{
+  entries_ctx ctx = { out, n, 0 };
+  UINT r = ValueEnumElements(pval, entries_cb, &ctx);
+  *pcount = ctx.count;
+  return r;
+}
+
+// ValueClear over a whole block
+void ValueClearAll( VALUE* vals, UINT n )
+{
+  for( UINT i = 0; i < n; ++i )
+    ValueClear(&vals[i]);
+}
+
+// Scalar reads returning the data, 0 when the VALUE holds none. Go passing
+// the address of a local to ValueIntData would move that local to the heap.
+INT ValueIntOrZero( const VALUE* pval )
+{
+  INT v = 0;
+  return ValueIntData(pval, &v) == HV_OK ? v : 0;
+}
+
+INT64 ValueInt64OrZero( const VALUE* pval )
+{
+  INT64 v = 0;
+  return ValueInt64Data(pval, &v) == HV_OK ? v : 0;
+}
+
+FLOAT_VALUE ValueFloatOrZero( const VALUE* pval )
+{
+  FLOAT_VALUE v = 0;
+  return ValueFloatData(pval, &v) == HV_OK ? v : 0;
+}
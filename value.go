@@ -1,258 +1,695 @@
-package sciter
-
-import (
-	"fmt"
-	"runtime"
-)
-
-type NativeFunctor func(args ...*Value) *Value
-
-// typedef VALUE SCITER_VALUE;
-// type Scitervalue Value
-
-type valueError struct {
-	Result  VALUE_RESULT
-	Message string
-}
-
-func (e *valueError) Error() string {
-	return fmt.Sprintf("%s: %s", e.Result.String(), e.Message)
-}
-
-func newValueError(ret VALUE_RESULT, msg string) *valueError {
-	return &valueError{
-		Result:  ret,
-		Message: msg,
-	}
-}
-
-func wrapValueResult(r VALUE_RESULT, msg string) error {
-	if r == VALUE_RESULT(HV_OK) {
-		return nil
-	}
-	return newValueError(VALUE_RESULT(r), msg)
-}
-
-func valuePanic(result uint, message ...interface{}) {
-	panic(&valueError{VALUE_RESULT(result), fmt.Sprint(message...)})
-}
-
-// Only supported basic types: int/bool/string/float/NativeFunctor/Value
-//	 for creating array: a := NewValue(); a.SetIndex(0, 123)|a.Append(123)
-//	 for creating map/object: obj := NewValue(); obj.Set("key", "value")
-// The creating process would call ValueInit/VlaueClear automatically
-func NewValue(val ...interface{}) *Value {
-	v := new(Value)
-	v.init()
-	runtime.SetFinalizer(v, (*Value).finalize)
-	if len(val) == 0 {
-		return v
-	}
-	v.Assign(val[0])
-	return v
-}
-
-func (v *Value) finalize() {
-	// log.Println("finalizing value:", v)
-	v.clear()
-}
-
-// release the object from sciter and go world
-func (v *Value) Release() {
-	runtime.SetFinalizer(v, nil)
-	v.finalize()
-}
-
-// Assign go value to Sciter Value
-// currently supported go types: bool integer float string and NativeFunctor
-func (v *Value) Assign(val interface{}) {
-	switch val.(type) {
-	case string:
-		s := val.(string)
-		v.SetString(s)
-	case int:
-		i := val.(int)
-		v.SetInt(i)
-	case float64:
-		f := val.(float64)
-		// valueInit(this); valueFloatDataSet(this, v, T_FLOAT, 0)
-		v.SetFloat(f)
-	case bool:
-		// value( bool v )           { valueInit(this); valueIntDataSet(this, v?1:0, T_BOOL, 0); }
-		v.SetBool(val.(bool))
-	case float32:
-		v.Assign(float64(val.(float32)))
-	case uint:
-		v.Assign(int(val.(uint)))
-	case uint32:
-		v.Assign(int(val.(uint32)))
-	case uint64:
-		v.Assign(int(val.(uint64)))
-	case int32:
-		v.Assign(int(val.(int32)))
-	case int64:
-		v.Assign(int(val.(int64)))
-	case Value:
-		vf := val.(Value)
-		v.Copy(&vf)
-	case *Value:
-		v.Copy(val.(*Value))
-	case NativeFunctor:
-		v.SetNativeFunctor(val.(NativeFunctor))
-	case func(args ...*Value) *Value:
-		v.SetNativeFunctor((NativeFunctor)(val.(func(args ...*Value) *Value)))
-	default:
-		nf, ok := val.(NativeFunctor)
-		if ok {
-			v.SetNativeFunctor(nf)
-		} else {
-			panic("unsupported value type")
-		}
-	}
-}
-
-// bool is_undefined() const { return t == T_UNDEFINED; }
-func (v *Value) IsUndefined() bool {
-	return v.t == T_UNDEFINED
-}
-
-// bool is_bool() const { return t == T_BOOL; }
-func (v *Value) IsBool() bool {
-	return v.t == T_BOOL
-}
-
-// bool is_int() const { return t == T_INT; }
-func (v *Value) IsInt() bool {
-	return v.t == T_INT
-}
-
-// bool is_float() const { return t == T_FLOAT; }
-func (v *Value) IsFloat() bool {
-	return v.t == T_FLOAT
-}
-
-// bool is_string() const { return t == T_STRING; }
-func (v *Value) IsString() bool {
-	return v.t == T_STRING
-}
-
-// bool is_symbol() const { return t == T_STRING && u == UT_SYMBOL; }
-func (v *Value) IsSymbol() bool {
-	return v.t == T_STRING && v.t == UT_SYMBOL
-}
-
-// bool is_date() const { return t == T_DATE; }
-func (v *Value) IsDate() bool {
-	return v.t == T_DATE
-}
-
-// bool is_currency() const { return t == T_CURRENCY; }
-func (v *Value) IsCurrency() bool {
-	return v.t == T_CURRENCY
-}
-
-// bool is_map() const { return t == T_MAP; }
-func (v *Value) IsMap() bool {
-	return v.t == T_MAP
-}
-
-// bool is_array() const { return t == T_ARRAY; }
-func (v *Value) IsArray() bool {
-	return v.t == T_ARRAY
-}
-
-// bool is_function() const { return t == T_FUNCTION; }
-func (v *Value) IsFunction() bool {
-	return v.t == T_FUNCTION
-}
-
-// bool is_color() const { return t == T_COLOR; }
-func (v *Value) IsColor() bool {
-	return v.t == T_COLOR
-}
-
-// bool is_duration() const { return t == T_DURATION; }
-func (v *Value) IsDuration() bool {
-	return v.t == T_DURATION
-}
-// bool is_angle() const { return t == T_ANGLE; }
-func (v *Value) IsAngle() bool {
-	return v.t == T_ANGLE
-}
-
-// bool is_asset() const { return t == T_ASSET; }
-func (v *Value) IsAsset() bool {
-	return v.t == T_ASSET
-}
-
-// bool is_bytes() const { return t == T_BYTES; }
-func (v *Value) IsByte() bool {
-	return v.t == T_BYTES
-}
-
-// bool is_object() const { return t == T_OBJECT; }
-func (v *Value) IsObject() bool {
-	return v.t == T_OBJECT
-}
-
-// bool is_object_native() const   {  return t == T_OBJECT && u == UT_OBJECT_NATIVE; }
-func (v *Value) IsObjectNative() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_NATIVE
-}
-
-// bool is_object_array() const    {  return t == T_OBJECT && u == UT_OBJECT_ARRAY; }
-func (v *Value) IsObjectArray() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_ARRAY
-}
-
-// bool is_object_function() const {  return t == T_OBJECT && u == UT_OBJECT_FUNCTION; }
-func (v *Value) IsObjectFunction() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_FUNCTION
-}
-
-// bool is_object_object() const   {  return t == T_OBJECT && u == UT_OBJECT_OBJECT; } // that is plain TS object
-func (v *Value) IsObjectObject() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_OBJECT
-}
-
-// bool is_object_class() const    {  return t == T_OBJECT && u == UT_OBJECT_CLASS; }  // that is TS class
-func (v *Value) IsObjectClass() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_CLASS
-}
-
-// bool is_object_error() const    {  return t == T_OBJECT && u == UT_OBJECT_ERROR; }  // that is TS error
-func (v *Value) IsObjectE() bool {
-	return v.t == T_OBJECT && v.u == UT_OBJECT_ERROR
-}
-
-// bool is_dom_element() const { return t == T_DOM_OBJECT; }
-func (v *Value) IsDomElement() bool {
-	return v.t == T_DOM_OBJECT
-}
-
-// bool is_null() const { return t == T_NULL; }
-func (v *Value) IsNull() bool {
-	return v.t == T_NULL
-}
-
-// // static value null() { value n; n.t = T_NULL; return n; }
-func NullValue() *Value {
-	v := new(Value)
-	v.init()
-	v.t = T_NULL
-	return v
-}
-
-// bool is_nothing() const { return t == T_UNDEFINED && u == UT_NOTHING; }
-func (v *Value) IsNothing() bool {
-	return v.t == T_UNDEFINED && v.u == UT_NOTHING
-}
-
-// static value nothing() { value n; n.t = T_UNDEFINED; n.u = UT_NOTHING; return n; }
-func NothingValue() *Value {
-	v := new(Value)
-	v.init()
-	v.t = T_UNDEFINED
-	v.u = UT_NOTHING
-	return v
-}
+package sciter
+
+/*
+#include "sciter-x.h"
+
+extern UINT ValueArrayAppendInts( VALUE* pval, const INT* items, UINT n );
+extern UINT ValueArrayAppendFloats( VALUE* pval, const FLOAT_VALUE* items, UINT n );
+extern UINT ValueArrayAppendStrings( VALUE* pval, LPCWSTR chars, const UINT* lengths, UINT n );
+extern UINT ValueArrayAppendValues( VALUE* pval, const VALUE* items, UINT n );
+extern UINT ValueArrayGetInts( const VALUE* pval, INT* out, UINT n );
+extern UINT ValueArrayGetFloats( const VALUE* pval, FLOAT_VALUE* out, UINT n );
+extern UINT ValueArrayGetStrings( const VALUE* pval, LPCWSTR* chars, UINT* lengths, UINT n );
+extern UINT ValueArrayGetValues( const VALUE* pval, VALUE* out, UINT n );
+extern UINT ValueMapGetEntries( const VALUE* pval, VALUE* out, UINT n, UINT* pcount );
+extern void ValueClearAll( VALUE* vals, UINT n );
+*/
+import "C"
+import (
+	"fmt"
+	"math"
+	"runtime"
+	"sync"
+	"sync/atomic"
+	"unsafe"
+)
+
+type NativeFunctor func(args ...*Value) *Value
+
+// typedef VALUE SCITER_VALUE;
+// type Scitervalue Value
+
+type valueError struct {
+	Result  VALUE_RESULT
+	Message string
+}
+
+func (e *valueError) Error() string {
+	return fmt.Sprintf("%s: %s", e.Result.String(), e.Message)
+}
+
+func newValueError(ret VALUE_RESULT, msg string) *valueError {
+	return &valueError{
+		Result:  ret,
+		Message: msg,
+	}
+}
+
+func wrapValueResult(r VALUE_RESULT, msg string) error {
+	if r == VALUE_RESULT(HV_OK) {
+		return nil
+	}
+	return newValueError(VALUE_RESULT(r), msg)
+}
+
+func valuePanic(result uint, message ...interface{}) {
+	panic(&valueError{VALUE_RESULT(result), fmt.Sprint(message...)})
+}
+
+// Only supported basic types: int/bool/string/float/NativeFunctor/Value
+//	 for creating array: a := NewValue(); a.SetIndex(0, 123)|a.Append(123)
+//	 for creating map/object: obj := NewValue(); obj.Set("key", "value")
+// The creating process would call ValueInit/VlaueClear automatically
+func NewValue(val ...interface{}) *Value {
+	v := new(Value)
+	v.init()
+	runtime.SetFinalizer(v, (*Value).finalize)
+	if len(val) == 0 {
+		return v
+	}
+	v.Assign(val[0])
+	return v
+}
+
+func (v *Value) finalize() {
+	// log.Println("finalizing value:", v)
+	v.clear()
+}
+
+// release the object from sciter and go world
+func (v *Value) Release() {
+	runtime.SetFinalizer(v, nil)
+	v.finalize()
+}
+
+// Assign go value to Sciter Value
+// currently supported go types: bool integer float string and NativeFunctor
+func (v *Value) Assign(val interface{}) {
+	switch val.(type) {
+	case string:
+		s := val.(string)
+		v.SetString(s)
+	case int:
+		i := val.(int)
+		v.SetInt(i)
+	case float64:
+		f := val.(float64)
+		// valueInit(this); valueFloatDataSet(this, v, T_FLOAT, 0)
+		v.SetFloat(f)
+	case bool:
+		// value( bool v )           { valueInit(this); valueIntDataSet(this, v?1:0, T_BOOL, 0); }
+		v.SetBool(val.(bool))
+	case float32:
+		v.Assign(float64(val.(float32)))
+	case uint:
+		v.Assign(int(val.(uint)))
+	case uint32:
+		v.Assign(int(val.(uint32)))
+	case uint64:
+		v.Assign(int(val.(uint64)))
+	case int32:
+		v.Assign(int(val.(int32)))
+	case int64:
+		v.Assign(int(val.(int64)))
+	case Value:
+		vf := val.(Value)
+		v.Copy(&vf)
+	case *Value:
+		v.Copy(val.(*Value))
+	case NativeFunctor:
+		v.SetNativeFunctor(val.(NativeFunctor))
+	case NativeFunc:
+		v.SetNativeFunc(val.(NativeFunc))
+	case func(args ...*Value) *Value:
+		v.SetNativeFunctor((NativeFunctor)(val.(func(args ...*Value) *Value)))
+	default:
+		nf, ok := val.(NativeFunctor)
+		if ok {
+			v.SetNativeFunctor(nf)
+		} else {
+			panic("unsupported value type")
+		}
+	}
+}
+
+// NewValueFromSlice creates an array Value from []int, []float64, []string or []*Value.
+// The whole array is built in one cgo call, see AppendSlice.
+func NewValueFromSlice(slice interface{}) *Value {
+	v := NewValue()
+	if err := v.AppendSlice(slice); err != nil {
+		panic(err)
+	}
+	return v
+}
+
+// AppendSlice appends all items of a []int, []float64, []string or []*Value
+// to the array in a single cgo call, instead of one Append per item.
+// An undefined Value becomes an array first. Ints must fit an int32 and
+// Values must not be nil, otherwise nothing is appended.
+func (v *Value) AppendSlice(slice interface{}) error {
+	cv := (*C.VALUE)(unsafe.Pointer(v))
+	switch s := slice.(type) {
+	case []int:
+		var items *C.INT
+		if len(s) > 0 {
+			ints := make([]C.INT, len(s))
+			for i, x := range s {
+				if x < math.MinInt32 || x > math.MaxInt32 {
+					return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("AppendSlice: item %d (%d) does not fit an int32", i, x))
+				}
+				ints[i] = C.INT(x)
+			}
+			items = &ints[0]
+		}
+		r := C.ValueArrayAppendInts(cv, items, C.UINT(len(s)))
+		return wrapValueResult(VALUE_RESULT(r), "ValueArrayAppendInts")
+	case []float64:
+		var items *C.FLOAT_VALUE
+		if len(s) > 0 {
+			items = (*C.FLOAT_VALUE)(unsafe.Pointer(&s[0]))
+		}
+		r := C.ValueArrayAppendFloats(cv, items, C.UINT(len(s)))
+		return wrapValueResult(VALUE_RESULT(r), "ValueArrayAppendFloats")
+	case []string:
+		// all strings go back to back into one NUL separated buffer
+		size := 1
+		for _, str := range s {
+			size += len(str) + 1
+		}
+		sc := newScratch()
+		if cap(sc.u16) < size {
+			sc.u16 = make([]uint16, 0, size)
+		}
+		lengths := make([]C.UINT, len(s))
+		for i, str := range s {
+			start := len(sc.u16)
+			sc.u16 = appendUtf16(sc.u16, str)
+			lengths[i] = C.UINT(len(sc.u16) - start - 1)
+		}
+		sc.u16 = append(sc.u16, 0)
+		chars := C.LPCWSTR(unsafe.Pointer(&sc.u16[0]))
+		var clengths *C.UINT
+		if len(s) > 0 {
+			clengths = &lengths[0]
+		}
+		r := C.ValueArrayAppendStrings(cv, chars, clengths, C.UINT(len(s)))
+		sc.release()
+		return wrapValueResult(VALUE_RESULT(r), "ValueArrayAppendStrings")
+	case []*Value:
+		// bitwise copies only borrow the values, the array takes its own references
+		var items *C.VALUE
+		if len(s) > 0 {
+			vals := make([]Value, len(s))
+			for i, x := range s {
+				if x == nil {
+					return newValueError(HV_BAD_PARAMETER, fmt.Sprintf("AppendSlice: item %d is nil", i))
+				}
+				vals[i] = *x
+			}
+			items = (*C.VALUE)(unsafe.Pointer(&vals[0]))
+		}
+		r := C.ValueArrayAppendValues(cv, items, C.UINT(len(s)))
+		runtime.KeepAlive(s)
+		return wrapValueResult(VALUE_RESULT(r), "ValueArrayAppendValues")
+	}
+	return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("AppendSlice: unsupported type %T", slice))
+}
+
+// ToSlice reads all elements of the array into a *[]int, *[]float64, *[]string or *[]*Value
+// in a single cgo call. Elements that do not convert read as zero values,
+// non-string elements of a *[]string get their String() representation.
+func (v *Value) ToSlice(dst interface{}) error {
+	cv := (*C.VALUE)(unsafe.Pointer(v))
+	n := v.Length()
+	cn := C.UINT(n)
+	// the slices below get one spare slot so &x[0] is valid for empty arrays
+	switch d := dst.(type) {
+	case *[]int:
+		items := make([]C.INT, n+1)
+		C.ValueArrayGetInts(cv, &items[0], cn)
+		out := make([]int, n)
+		for i := range out {
+			out[i] = int(items[i])
+		}
+		*d = out
+	case *[]float64:
+		out := make([]float64, n+1)
+		C.ValueArrayGetFloats(cv, (*C.FLOAT_VALUE)(unsafe.Pointer(&out[0])), cn)
+		*d = out[:n]
+	case *[]string:
+		chars := make([]C.LPCWSTR, n+1)
+		lengths := make([]C.UINT, n+1)
+		C.ValueArrayGetStrings(cv, &chars[0], &lengths[0], cn)
+		out := make([]string, n)
+		for i := range out {
+			if chars[i] == nil {
+				out[i] = v.Index(i).String()
+				continue
+			}
+			out[i] = Utf16ToStringLength((*uint16)(unsafe.Pointer(chars[i])), int(lengths[i]))
+		}
+		runtime.KeepAlive(v)
+		*d = out
+	case *[]*Value:
+		block := make([]Value, n+1)
+		C.ValueArrayGetValues(cv, (*C.VALUE)(unsafe.Pointer(&block[0])), cn)
+		// moving a VALUE bitwise hands its reference over, the block itself is never cleared
+		out := make([]*Value, n)
+		for i := range out {
+			e := new(Value)
+			*e = block[i]
+			runtime.SetFinalizer(e, (*Value).finalize)
+			out[i] = e
+		}
+		*d = out
+	default:
+		return newValueError(HV_INCOMPATIBLE_TYPE, fmt.Sprintf("ToSlice: unsupported type %T", dst))
+	}
+	return nil
+}
+
+// ValueEntries holds the key/value pairs of a map read by Value.Entries.
+// Keys and values live in one block owned by the ValueEntries: the *Value views
+// returned by Key and Value are borrowed, valid until Release is called, and must
+// be Clone()d to outlive it. Without Release the block is cleared once neither
+// the ValueEntries nor any of its views is reachable.
+type ValueEntries struct {
+	block []Value
+}
+
+// Entries copies all key/value pairs of a T_MAP, T_FUNCTION or T_OBJECT Value
+// in a single cgo call, instead of one NthElementKey and one Index per pair.
+func (v *Value) Entries() (*ValueEntries, error) {
+	e := &ValueEntries{}
+	n := v.Length()
+	if n <= 0 {
+		return e, nil
+	}
+	block := make([]Value, 2*n)
+	// args
+	cv := (*C.VALUE)(unsafe.Pointer(v))
+	cout := (*C.VALUE)(unsafe.Pointer(&block[0]))
+	var count C.UINT
+	// cgo call
+	r := C.ValueMapGetEntries(cv, cout, C.UINT(n), &count)
+	e.block = block[:2*int(count)]
+	if len(e.block) > 0 {
+		// on the block rather than on e: the views point into it and keep it reachable
+		n := len(e.block)
+		runtime.SetFinalizer(&e.block[0], func(first *Value) {
+			C.ValueClearAll((*C.VALUE)(unsafe.Pointer(first)), C.UINT(n))
+		})
+	}
+	if err := wrapValueResult(VALUE_RESULT(r), "ValueEnumElements"); err != nil {
+		e.Release()
+		return nil, err
+	}
+	return e, nil
+}
+
+// Len returns the number of pairs
+func (e *ValueEntries) Len() int {
+	return len(e.block) / 2
+}
+
+// Key returns a borrowed view of the i-th key
+func (e *ValueEntries) Key(i int) *Value {
+	return &e.block[2*i]
+}
+
+// Value returns a borrowed view of the i-th value
+func (e *ValueEntries) Value(i int) *Value {
+	return &e.block[2*i+1]
+}
+
+// Release clears all pairs at once, the views must not be used afterwards
+func (e *ValueEntries) Release() {
+	if len(e.block) > 0 {
+		runtime.SetFinalizer(&e.block[0], nil)
+		C.ValueClearAll((*C.VALUE)(unsafe.Pointer(&e.block[0])), C.UINT(len(e.block)))
+	}
+	e.block = nil
+}
+
+// ValueScope is an arena for short-lived Values.
+// Values allocated from a scope have no finalizer: they are kept in contiguous
+// blocks and all cleared by one batched ValueClear pass in Close, instead of
+// each waiting for the GC finalizer goroutine. They must not be used after Close,
+// Clone() those that have to outlive the scope.
+type ValueScope struct {
+	// nil once closed
+	blocks [][]Value
+	// number of Values handed out from the last block
+	used int
+	// holder of the first block, handed back to valueBlockPool by Close
+	first *valueBlock
+	// backing array of blocks, so that a scope takes a single allocation
+	inline [2][]Value
+}
+
+type valueBlock struct {
+	values []Value
+}
+
+const valueScopeBlockSize = 32
+
+// blocks of closed scopes; the scopes themselves are not recycled, so that
+// a stale *ValueScope never refers to the Values of a later scope
+var valueBlockPool = sync.Pool{
+	New: func() interface{} {
+		return &valueBlock{make([]Value, valueScopeBlockSize)}
+	},
+}
+
+// NewValueScope returns an empty scope, it must be closed once done with
+func NewValueScope() *ValueScope {
+	s := &ValueScope{first: valueBlockPool.Get().(*valueBlock)}
+	s.blocks = append(s.inline[:0], s.first.values)
+	return s
+}
+
+func (s *ValueScope) alloc() *Value {
+	if s.blocks == nil {
+		panic("ValueScope: used after Close")
+	}
+	last := s.blocks[len(s.blocks)-1]
+	if s.used == len(last) {
+		// earlier blocks are still referenced, so grow by adding a bigger one
+		last = make([]Value, 2*len(last))
+		s.blocks = append(s.blocks, last)
+		s.used = 0
+	}
+	v := &last[s.used]
+	s.used++
+	v.init()
+	return v
+}
+
+// NewValue is the scoped counterpart of the package level NewValue
+func (s *ValueScope) NewValue(val ...interface{}) *Value {
+	v := s.alloc()
+	if len(val) > 0 {
+		v.Assign(val[0])
+	}
+	return v
+}
+
+// Index is the scoped counterpart of Value.Index
+func (s *ValueScope) Index(v *Value, n int) *Value {
+	ret := s.alloc()
+	r := C.ValueNthElementValue((*C.VALUE)(unsafe.Pointer(v)), C.INT(n), (*C.VALUE)(unsafe.Pointer(ret)))
+	if r != C.UINT(HV_OK) {
+		return nil
+	}
+	return ret
+}
+
+// Get is the scoped counterpart of Value.Get
+func (s *ValueScope) Get(v *Value, key string) *Value {
+	k, ret := s.NewValue(key), s.alloc()
+	r := C.ValueGetValueOfKey((*C.VALUE)(unsafe.Pointer(v)), (*C.VALUE)(unsafe.Pointer(k)), (*C.VALUE)(unsafe.Pointer(ret)))
+	if r != C.UINT(HV_OK) {
+		return nil
+	}
+	return ret
+}
+
+// Close clears every Value of the scope and recycles its storage,
+// closing a closed scope does nothing
+func (s *ValueScope) Close() {
+	if s.blocks == nil {
+		return
+	}
+	for i, b := range s.blocks {
+		n := len(b)
+		if i == len(s.blocks)-1 {
+			n = s.used
+		}
+		if n > 0 {
+			C.ValueClearAll((*C.VALUE)(unsafe.Pointer(&b[0])), C.UINT(n))
+		}
+	}
+	// keep only the largest block for the next scope
+	s.first.values = s.blocks[len(s.blocks)-1]
+	valueBlockPool.Put(s.first)
+	s.blocks, s.first, s.used = nil, nil, 0
+	s.inline = [2][]Value{}
+}
+
+// scopes handed out by ScriptingMethodParams.Scope, by the params of the call
+// being dispatched; calls that never ask for one do not take the lock
+var (
+	callScopes     = map[*ScriptingMethodParams]*ValueScope{}
+	callScopesLock sync.Mutex
+	// len(callScopes), read without the lock
+	callScopesCount int32
+)
+
+func callScope(p *ScriptingMethodParams) *ValueScope {
+	callScopesLock.Lock()
+	defer callScopesLock.Unlock()
+	s := callScopes[p]
+	if s == nil {
+		s = NewValueScope()
+		callScopes[p] = s
+		atomic.AddInt32(&callScopesCount, 1)
+	}
+	return s
+}
+
+// closeCallScope closes the scope of the call p, if it asked for one
+func closeCallScope(p *ScriptingMethodParams) {
+	if atomic.LoadInt32(&callScopesCount) == 0 {
+		return
+	}
+	callScopesLock.Lock()
+	s := callScopes[p]
+	if s != nil {
+		delete(callScopes, p)
+		atomic.AddInt32(&callScopesCount, -1)
+	}
+	callScopesLock.Unlock()
+	if s != nil {
+		s.Close()
+	}
+}
+
+// ValueKey is an interned, immutable key Value.
+// Keys are created once per name and never released, so SetKey/GetKey
+// with a ValueKey do no UTF-16 encoding and no engine allocation for the key.
+type ValueKey struct {
+	v Value
+}
+
+var (
+	keyStrings sync.Map // map[string]*ValueKey
+	keySymbols sync.Map // map[string]*ValueKey
+)
+
+func internKey(table *sync.Map, name string, uintType int) *ValueKey {
+	if k, ok := table.Load(name); ok {
+		return k.(*ValueKey)
+	}
+	k := new(ValueKey)
+	k.v.init()
+	if err := k.v.SetString(name, uintType); err != nil {
+		panic(err)
+	}
+	if prev, loaded := table.LoadOrStore(name, k); loaded {
+		k.v.clear()
+		return prev.(*ValueKey)
+	}
+	return k
+}
+
+// InternKey returns the interned string key for name
+func InternKey(name string) *ValueKey {
+	return internKey(&keyStrings, name, int(C.UT_STRING_STRING))
+}
+
+// InternSymbol returns the interned symbol key for name, see NewSymbol
+func InternSymbol(name string) *ValueKey {
+	return internKey(&keySymbols, name, int(C.UT_STRING_SYMBOL))
+}
+
+// Value returns the key itself, it must not be modified
+func (k *ValueKey) Value() *Value {
+	return &k.v
+}
+
+// SetKey is Set with an interned key, a *Value val is stored without an intermediate copy
+func (v *Value) SetKey(key *ValueKey, val interface{}) error {
+	pval, ok := val.(*Value)
+	if !ok {
+		// copied by the engine, no finalized wrapper needed
+		pval = newTempValue()
+		defer pval.clear()
+		pval.Assign(val)
+	}
+	// args
+	cv := (*C.VALUE)(unsafe.Pointer(v))
+	ckey := (*C.VALUE)(unsafe.Pointer(&key.v))
+	cval := (*C.VALUE)(unsafe.Pointer(pval))
+	// cgo call
+	return wrapValueResult(VALUE_RESULT(C.ValueSetValueToKey(cv, ckey, cval)), "ValueSetValueToKey")
+}
+
+// GetKey is Get with an interned key
+func (v *Value) GetKey(key *ValueKey) *Value {
+	val := NewValue()
+	// args
+	cv := (*C.VALUE)(unsafe.Pointer(v))
+	ckey := (*C.VALUE)(unsafe.Pointer(&key.v))
+	cval := (*C.VALUE)(unsafe.Pointer(val))
+	// cgo call
+	if C.ValueGetValueOfKey(cv, ckey, cval) != C.UINT(HV_OK) {
+		return nil
+	}
+	return val
+}
+
+// bool is_undefined() const { return t == T_UNDEFINED; }
+func (v *Value) IsUndefined() bool {
+	return v.t == T_UNDEFINED
+}
+
+// bool is_bool() const { return t == T_BOOL; }
+func (v *Value) IsBool() bool {
+	return v.t == T_BOOL
+}
+
+// bool is_int() const { return t == T_INT; }
+func (v *Value) IsInt() bool {
+	return v.t == T_INT
+}
+
+// bool is_float() const { return t == T_FLOAT; }
+func (v *Value) IsFloat() bool {
+	return v.t == T_FLOAT
+}
+
+// bool is_string() const { return t == T_STRING; }
+func (v *Value) IsString() bool {
+	return v.t == T_STRING
+}
+
+// bool is_symbol() const { return t == T_STRING && u == UT_SYMBOL; }
+func (v *Value) IsSymbol() bool {
+	return v.t == T_STRING && v.t == UT_SYMBOL
+}
+
+// bool is_date() const { return t == T_DATE; }
+func (v *Value) IsDate() bool {
+	return v.t == T_DATE
+}
+
+// bool is_currency() const { return t == T_CURRENCY; }
+func (v *Value) IsCurrency() bool {
+	return v.t == T_CURRENCY
+}
+
+// bool is_map() const { return t == T_MAP; }
+func (v *Value) IsMap() bool {
+	return v.t == T_MAP
+}
+
+// bool is_array() const { return t == T_ARRAY; }
+func (v *Value) IsArray() bool {
+	return v.t == T_ARRAY
+}
+
+// bool is_function() const { return t == T_FUNCTION; }
+func (v *Value) IsFunction() bool {
+	return v.t == T_FUNCTION
+}
+
+// bool is_color() const { return t == T_COLOR; }
+func (v *Value) IsColor() bool {
+	return v.t == T_COLOR
+}
+
+// bool is_duration() const { return t == T_DURATION; }
+func (v *Value) IsDuration() bool {
+	return v.t == T_DURATION
+}
+// bool is_angle() const { return t == T_ANGLE; }
+func (v *Value) IsAngle() bool {
+	return v.t == T_ANGLE
+}
+
+// bool is_asset() const { return t == T_ASSET; }
+func (v *Value) IsAsset() bool {
+	return v.t == T_ASSET
+}
+
+// bool is_bytes() const { return t == T_BYTES; }
+func (v *Value) IsByte() bool {
+	return v.t == T_BYTES
+}
+
+// bool is_object() const { return t == T_OBJECT; }
+func (v *Value) IsObject() bool {
+	return v.t == T_OBJECT
+}
+
+// bool is_object_native() const   {  return t == T_OBJECT && u == UT_OBJECT_NATIVE; }
+func (v *Value) IsObjectNative() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_NATIVE
+}
+
+// bool is_object_array() const    {  return t == T_OBJECT && u == UT_OBJECT_ARRAY; }
+func (v *Value) IsObjectArray() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_ARRAY
+}
+
+// bool is_object_function() const {  return t == T_OBJECT && u == UT_OBJECT_FUNCTION; }
+func (v *Value) IsObjectFunction() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_FUNCTION
+}
+
+// bool is_object_object() const   {  return t == T_OBJECT && u == UT_OBJECT_OBJECT; } // that is plain TS object
+func (v *Value) IsObjectObject() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_OBJECT
+}
+
+// bool is_object_class() const    {  return t == T_OBJECT && u == UT_OBJECT_CLASS; }  // that is TS class
+func (v *Value) IsObjectClass() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_CLASS
+}
+
+// bool is_object_error() const    {  return t == T_OBJECT && u == UT_OBJECT_ERROR; }  // that is TS error
+func (v *Value) IsObjectE() bool {
+	return v.t == T_OBJECT && v.u == UT_OBJECT_ERROR
+}
+
+// bool is_dom_element() const { return t == T_DOM_OBJECT; }
+func (v *Value) IsDomElement() bool {
+	return v.t == T_DOM_OBJECT
+}
+
+// bool is_null() const { return t == T_NULL; }
+func (v *Value) IsNull() bool {
+	return v.t == T_NULL
+}
+
+// // static value null() { value n; n.t = T_NULL; return n; }
+func NullValue() *Value {
+	v := new(Value)
+	v.init()
+	v.t = T_NULL
+	return v
+}
+
+// bool is_nothing() const { return t == T_UNDEFINED && u == UT_NOTHING; }
+func (v *Value) IsNothing() bool {
+	return v.t == T_UNDEFINED && v.u == UT_NOTHING
+}
+
+// static value nothing() { value n; n.t = T_UNDEFINED; n.u = UT_NOTHING; return n; }
+func NothingValue() *Value {
+	v := new(Value)
+	v.init()
+	v.t = T_UNDEFINED
+	v.u = UT_NOTHING
+	return v
+}
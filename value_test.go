@@ -0,0 +1,70 @@
+package sciter
+
+import (
+	"strconv"
+	"testing"
+)
+
+func TestValueScopeClose(t *testing.T) {
+	s := NewValueScope()
+	s.Close()
+	if s.blocks != nil {
+		t.Fatal("closed scope kept its blocks")
+	}
+	// a second Close must not hand the block to the pool again
+	s.Close()
+	a, b := NewValueScope(), NewValueScope()
+	if &a.blocks[0][0] == &b.blocks[0][0] {
+		t.Fatal("two open scopes share a block")
+	}
+	a.Close()
+	b.Close()
+	defer func() {
+		if recover() == nil {
+			t.Fatal("alloc on a closed scope did not panic")
+		}
+	}()
+	s.alloc()
+}
+
+func TestCallScope(t *testing.T) {
+	var outer, inner ScriptingMethodParams
+	s := outer.Scope()
+	if outer.Scope() != s {
+		t.Fatal("a second Scope call returned another scope")
+	}
+	// a nested call gets its own scope
+	if inner.Scope() == s {
+		t.Fatal("nested calls share a scope")
+	}
+	closeCallScope(&inner)
+	if s.blocks == nil {
+		t.Fatal("closing the nested call closed the outer scope")
+	}
+	closeCallScope(&outer)
+	if s.blocks != nil {
+		t.Fatal("scope still open after the call")
+	}
+	if callScopesCount != 0 || len(callScopes) != 0 {
+		t.Fatalf("%d scopes still tracked", len(callScopes))
+	}
+}
+
+func TestAppendSliceRejects(t *testing.T) {
+	// checked before the engine is reached
+	var v Value
+	if err := v.AppendSlice([]*Value{new(Value), nil}); err == nil {
+		t.Error("nil item appended")
+	} else if e, ok := err.(*valueError); !ok || e.Result != HV_BAD_PARAMETER {
+		t.Errorf("nil item: %v, want HV_BAD_PARAMETER", err)
+	}
+	if strconv.IntSize == 64 {
+		big := int(1) << 40
+		if err := v.AppendSlice([]int{1, big}); err == nil {
+			t.Errorf("%d appended as an int32", big)
+		}
+		if err := v.AppendSlice([]int{-big}); err == nil {
+			t.Errorf("%d appended as an int32", -big)
+		}
+	}
+}
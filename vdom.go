@@ -0,0 +1,215 @@
+package sciter
+
+import "sort"
+
+// VNode is a node of a virtual DOM tree rendered from Go.
+//
+// An element either has Children or plain Text content; mixed text and element
+// content is not supported, wrap the text in a span instead.
+type VNode struct {
+	Tag   string
+	Attrs map[string]string
+	Text  string
+	// Key identifies the node among its siblings, so that reordered lists move
+	// their elements instead of rebuilding them. Unkeyed siblings are matched
+	// in order, by tag.
+	Key      string
+	Children []*VNode
+
+	// element the node is mounted on
+	el *Element
+}
+
+// H is a shorthand for building element nodes
+func H(tag string, attrs map[string]string, children ...*VNode) *VNode {
+	return &VNode{Tag: tag, Attrs: attrs, Children: children}
+}
+
+// HText is a shorthand for an element node with plain text content
+func HText(tag string, attrs map[string]string, text string) *VNode {
+	return &VNode{Tag: tag, Attrs: attrs, Text: text}
+}
+
+// Element returns the DOM element the node is mounted on, nil before it is rendered
+func (n *VNode) Element() *Element {
+	return n.el
+}
+
+// VDOM keeps the content of a container element in line with a virtual tree.
+//
+// Every Render diffs the new tree against the previous one and patches only
+// what changed, through one DOMBatch: unchanged elements are kept, so focus,
+// selection and scroll positions survive, and the patch cost follows the
+// size of the change instead of the size of the tree.
+type VDOM struct {
+	container *Element
+	children  []*VNode
+	batch     *DOMBatch
+}
+
+// NewVDOM takes over the content of container
+func NewVDOM(container *Element) *VDOM {
+	return &VDOM{
+		container: container.Retain(),
+		batch:     NewDOMBatch(),
+	}
+}
+
+// Render makes nodes the content of the container.
+// The nodes must be new ones, the previous tree must not be reused.
+func (d *VDOM) Render(nodes ...*VNode) error {
+	if d.children == nil {
+		// first render, whatever was there goes away
+		if err := d.container.Clear(); err != nil {
+			return err
+		}
+	}
+	if err := d.patchChildren(d.container, d.children, nodes); err != nil {
+		d.batch.Reset()
+		return err
+	}
+	d.children = nodes
+	if d.children == nil {
+		d.children = []*VNode{}
+	}
+	return d.batch.Run(d.container)
+}
+
+// mount creates the elements of a new node, the caller inserts n.el
+func (d *VDOM) mount(n *VNode) error {
+	el, err := CreateElement(n.Tag, n.Text)
+	if err != nil {
+		return err
+	}
+	n.el = el
+	for name, val := range n.Attrs {
+		d.batch.SetAttr(el, name, val)
+	}
+	for _, c := range n.Children {
+		if err := d.mount(c); err != nil {
+			return err
+		}
+		d.batch.Append(el, c.el)
+	}
+	return nil
+}
+
+// patch brings the element of old in line with n, which takes it over
+func (d *VDOM) patch(old, n *VNode) error {
+	el := old.el
+	n.el = el
+	for name, val := range n.Attrs {
+		if prev, ok := old.Attrs[name]; !ok || prev != val {
+			d.batch.SetAttr(el, name, val)
+		}
+	}
+	for name := range old.Attrs {
+		if _, ok := n.Attrs[name]; !ok {
+			d.batch.RemoveAttr(el, name)
+		}
+	}
+	switch {
+	case len(n.Children) == 0:
+		if len(old.Children) > 0 || old.Text != n.Text {
+			d.batch.SetText(el, n.Text)
+		}
+		return nil
+	case len(old.Children) == 0 && old.Text != "":
+		d.batch.SetText(el, "")
+		return d.patchChildren(el, nil, n.Children)
+	}
+	return d.patchChildren(el, old.Children, n.Children)
+}
+
+// patchChildren turns the children old of parent into nodes.
+//
+// Old children are matched by key, or by tag in order for unkeyed ones.
+// Unmatched old children are deleted; the matched ones that form the longest
+// run already in the right order stay where they are, only the others move.
+func (d *VDOM) patchChildren(parent *Element, old, nodes []*VNode) error {
+	keyed := make(map[string]int)
+	unkeyed := make(map[string][]int)
+	for i, o := range old {
+		if o.Key != "" {
+			keyed[o.Key] = i
+		} else {
+			unkeyed[o.Tag] = append(unkeyed[o.Tag], i)
+		}
+	}
+	// from[i] is the old index of nodes[i], -1 for new nodes
+	from := make([]int, len(nodes))
+	used := make([]bool, len(old))
+	for i, n := range nodes {
+		from[i] = -1
+		if n.Key != "" {
+			if j, ok := keyed[n.Key]; ok && old[j].Tag == n.Tag && !used[j] {
+				from[i] = j
+			}
+		} else if q := unkeyed[n.Tag]; len(q) > 0 {
+			from[i] = q[0]
+			unkeyed[n.Tag] = q[1:]
+		}
+		if from[i] >= 0 {
+			used[from[i]] = true
+		}
+	}
+	for j, o := range old {
+		if !used[j] {
+			d.batch.Delete(o.el)
+		}
+	}
+
+	stable := increasingRun(from)
+	// take out the matched elements that move, the stable ones are then in order
+	for i, j := range from {
+		if j >= 0 && !stable[i] {
+			d.batch.Detach(old[j].el)
+		}
+	}
+	for i, n := range nodes {
+		if j := from[i]; j >= 0 {
+			if err := d.patch(old[j], n); err != nil {
+				return err
+			}
+		} else if err := d.mount(n); err != nil {
+			return err
+		}
+		// everything before i is in place, stable nodes are already at i
+		if !stable[i] {
+			d.batch.Insert(parent, n.el, i)
+		}
+	}
+	return nil
+}
+
+// increasingRun marks a longest strictly increasing subsequence of the
+// non-negative values of from.
+func increasingRun(from []int) []bool {
+	// tails[k] is the index in from of the smallest tail of a run of length k+1
+	tails := make([]int, 0, len(from))
+	prev := make([]int, len(from))
+	for i, v := range from {
+		prev[i] = -1
+		if v < 0 {
+			continue
+		}
+		k := sort.Search(len(tails), func(k int) bool {
+			return from[tails[k]] >= v
+		})
+		if k > 0 {
+			prev[i] = tails[k-1]
+		}
+		if k == len(tails) {
+			tails = append(tails, i)
+		} else {
+			tails[k] = i
+		}
+	}
+	stable := make([]bool, len(from))
+	if len(tails) > 0 {
+		for i := tails[len(tails)-1]; i >= 0; i = prev[i] {
+			stable[i] = true
+		}
+	}
+	return stable
+}
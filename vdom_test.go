@@ -0,0 +1,152 @@
+package sciter
+
+import (
+	"math/rand"
+	"strconv"
+	"testing"
+)
+
+func TestIncreasingRun(t *testing.T) {
+	for _, c := range []struct {
+		from []int
+		want int
+	}{
+		{[]int{}, 0},
+		{[]int{0, 1, 2, 3}, 4},
+		{[]int{3, 2, 1, 0}, 1},
+		{[]int{3, 0, 1, 2}, 3},
+		{[]int{-1, 0, -1, 2, 1}, 2},
+	} {
+		stable := increasingRun(c.from)
+		n, last := 0, -1
+		for i, s := range stable {
+			if !s {
+				continue
+			}
+			if c.from[i] <= last {
+				t.Fatalf("%v: run %v is not increasing", c.from, stable)
+			}
+			n, last = n+1, c.from[i]
+		}
+		if n != c.want {
+			t.Errorf("%v: run of %d, want %d", c.from, n, c.want)
+		}
+	}
+}
+
+// mountedRows returns keyed rows as if rendered, on fake elements
+func mountedRows(n int) []*VNode {
+	rows := make([]*VNode, n)
+	for i := range rows {
+		rows[i] = HText("li", map[string]string{"class": "row"}, "row "+strconv.Itoa(i))
+		rows[i].Key = strconv.Itoa(i)
+		rows[i].el = fakeElement(i)
+	}
+	return rows
+}
+
+// rerender returns new nodes for the old rows in the given order
+func rerender(old []*VNode, order []int, text func(i int) string) []*VNode {
+	nodes := make([]*VNode, len(order))
+	for i, j := range order {
+		nodes[i] = HText("li", map[string]string{"class": "row"}, text(j))
+		nodes[i].Key = old[j].Key
+	}
+	return nodes
+}
+
+type vdomCase struct {
+	name  string
+	order func(n int) []int
+	text  func(i int) string
+}
+
+var vdomCases = []vdomCase{
+	{"unchanged", identity, rowText},
+	{"text", identity, func(i int) string {
+		if i%10 == 0 {
+			return "changed " + strconv.Itoa(i)
+		}
+		return rowText(i)
+	}},
+	{"move", func(n int) []int {
+		// the last row goes first
+		return append([]int{n - 1}, identity(n)[:n-1]...)
+	}, rowText},
+	{"reverse", func(n int) []int {
+		order := identity(n)
+		for i, j := 0, n-1; i < j; i, j = i+1, j-1 {
+			order[i], order[j] = order[j], order[i]
+		}
+		return order
+	}, rowText},
+	{"shuffle", func(n int) []int {
+		return rand.New(rand.NewSource(1)).Perm(n)
+	}, rowText},
+}
+
+func identity(n int) []int {
+	order := make([]int, n)
+	for i := range order {
+		order[i] = i
+	}
+	return order
+}
+
+func rowText(i int) string {
+	return "row " + strconv.Itoa(i)
+}
+
+func TestPatchChildrenMoves(t *testing.T) {
+	const n = 100
+	parent := fakeElement(n)
+	old := mountedRows(n)
+	// the commands each case needs: one Detach and one Insert per moved row
+	want := map[string]int{"unchanged": 0, "text": n / 10, "move": 2, "reverse": 2 * (n - 1)}
+	d := &VDOM{batch: NewDOMBatch()}
+	for _, c := range vdomCases {
+		w, ok := want[c.name]
+		if !ok {
+			continue
+		}
+		if err := d.patchChildren(parent, old, rerender(old, c.order(n), c.text)); err != nil {
+			t.Fatal(err)
+		}
+		if d.batch.Len() != w {
+			t.Errorf("%s: %d commands, want %d", c.name, d.batch.Len(), w)
+		}
+		d.batch.Reset()
+	}
+}
+
+func BenchmarkVDOMDiff(b *testing.B) {
+	for _, n := range []int{100, 1000, 10000} {
+		parent := fakeElement(n)
+		old := mountedRows(n)
+		for _, c := range vdomCases {
+			nodes := rerender(old, c.order(n), c.text)
+			b.Run(strconv.Itoa(n)+"/"+c.name, func(b *testing.B) {
+				d := &VDOM{batch: NewDOMBatch()}
+				b.ReportAllocs()
+				for i := 0; i < b.N; i++ {
+					if err := d.patchChildren(parent, old, nodes); err != nil {
+						b.Fatal(err)
+					}
+					d.batch.Reset()
+				}
+			})
+		}
+	}
+}
+
+func BenchmarkIncreasingRun(b *testing.B) {
+	for _, n := range []int{100, 1000, 10000} {
+		from := rand.New(rand.NewSource(1)).Perm(n)
+		b.Run(strconv.Itoa(n), func(b *testing.B) {
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				increasingRun(from)
+			}
+		})
+	}
+}
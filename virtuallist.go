@@ -0,0 +1,281 @@
+package sciter
+
+import "strconv"
+
+// the row height could not be measured, e.g. before the first layout
+var errVirtualRowHeight = newDomError(SCDOM_OPERATION_FAILED, "VirtualList: unknown row height")
+
+// VirtualListSource provides the rows shown by a VirtualList.
+type VirtualListSource interface {
+	// Len returns the number of rows of the dataset
+	Len() int
+	// Render fills row with the content of the row at index.
+	// Mutations should be recorded in batch, it is run once per refresh.
+	Render(batch *DOMBatch, row *Element, index int)
+}
+
+// VirtualList shows a dataset of any size in a scrollable container
+// (an element with overflow:auto or scroll) while keeping only the visible
+// window of row elements in the DOM.
+//
+// Two spacer elements stand in for the rows above and below the window so that
+// the scrollbar reflects the whole dataset. Rows scrolled out of view are moved
+// to the other end of the window and re-populated from the source, rows no longer
+// needed (e.g. after a resize) wait in a pool, so the DOM size, memory and
+// frame time stay flat however many rows there are.
+type VirtualList struct {
+	container *Element
+	source    VirtualListSource
+	// all rows have the same height, 0 means measure the first row
+	rowHeight int
+	rowTag    string
+	// extra rows rendered below the view to hide re-population while scrolling
+	Overscan int
+	// OnError receives the errors of the refreshes run on size, scroll and
+	// timer events, which have no caller to return them to. Nil drops them.
+	OnError func(error)
+
+	top, bottom *Element
+	// the window: rows[i] shows the item first+i, rowIndex[i] is what it shows now
+	rows     []*Element
+	rowIndex []int
+	pool     []*Element
+	first    int
+	batch    *DOMBatch
+	handler  *EventHandler
+}
+
+// NewVirtualList turns container into a virtual list of rowTag elements of
+// rowHeight pixels each (0 to measure the first rendered row).
+// The container content is replaced.
+func NewVirtualList(container *Element, source VirtualListSource, rowTag string, rowHeight int) (*VirtualList, error) {
+	l := &VirtualList{
+		container: container.Retain(),
+		source:    source,
+		rowHeight: rowHeight,
+		rowTag:    rowTag,
+		Overscan:  2,
+		batch:     NewDOMBatch(),
+	}
+	if err := l.container.Clear(); err != nil {
+		return nil, err
+	}
+	var err error
+	if l.top, err = CreateElement(rowTag, ""); err != nil {
+		return nil, err
+	}
+	if l.bottom, err = CreateElement(rowTag, ""); err != nil {
+		return nil, err
+	}
+	l.batch.Append(l.container, l.top)
+	l.batch.Append(l.container, l.bottom)
+	if err := l.batch.Run(nil); err != nil {
+		return nil, err
+	}
+	l.handler = &EventHandler{
+		OnSize: func(he *Element) {
+			l.report(l.Refresh())
+		},
+		OnScroll: func(he *Element, params *ScrollParams) bool {
+			if params.Vertical != 0 {
+				l.report(l.Refresh())
+				// refresh once more when the scroll position has settled
+				l.report(l.container.SetTimer(16))
+			}
+			return false
+		},
+		OnTimer: func(he *Element, params *TimerParams) bool {
+			l.report(l.Refresh())
+			// one shot
+			return false
+		},
+	}
+	if err := l.container.AttachEventHandler(l.handler); err != nil {
+		return nil, err
+	}
+	if err := l.Refresh(); err != errVirtualRowHeight {
+		return l, err
+	}
+	// not laid out yet, the OnSize of the first layout measures again
+	return l, nil
+}
+
+func (l *VirtualList) report(err error) {
+	if err != nil && l.OnError != nil {
+		l.OnError(err)
+	}
+}
+
+// Close detaches the list from its container, the rows stay as they are
+func (l *VirtualList) Close() error {
+	return l.container.DetachEventHandler(l.handler)
+}
+
+// Invalidate re-renders all visible rows, e.g. after the dataset changed
+func (l *VirtualList) Invalidate() error {
+	for i := range l.rowIndex {
+		l.rowIndex[i] = -1
+	}
+	return l.Refresh()
+}
+
+// ScrollTo scrolls the container so that the row at index is at the top.
+// It fails while the row height is unknown, e.g. for an empty list that was
+// created with a row height of 0.
+func (l *VirtualList) ScrollTo(index int) error {
+	if l.rowHeight <= 0 {
+		// measure now rather than scroll nowhere
+		if err := l.Refresh(); err != nil {
+			return err
+		}
+		if l.rowHeight <= 0 {
+			return errVirtualRowHeight
+		}
+	}
+	pos, _, _, err := l.container.ScrollInfo()
+	if err != nil {
+		return err
+	}
+	pos.Y = int32(index * l.rowHeight)
+	if err := l.container.SetScrollPos(pos, false); err != nil {
+		return err
+	}
+	return l.Refresh()
+}
+
+func (l *VirtualList) takeRow() (*Element, error) {
+	if n := len(l.pool); n > 0 {
+		row := l.pool[n-1]
+		l.pool[n-1] = nil
+		l.pool = l.pool[:n-1]
+		return row, nil
+	}
+	return CreateElement(l.rowTag, "")
+}
+
+// Refresh brings the window of rows in line with the scroll position,
+// view size and dataset length. When the row height is to be measured and that
+// fails, the rows are shown but the spacers stay unsized and the error is
+// returned; the next Refresh measures again.
+func (l *VirtualList) Refresh() error {
+	pos, view, _, err := l.container.ScrollInfo()
+	if err != nil {
+		return err
+	}
+	total := l.source.Len()
+	first, count := virtualWindow(int(pos.Y), int(view.Bottom-view.Top), l.rowHeight, l.Overscan, total)
+	if err := l.layout(first, count); err != nil {
+		return err
+	}
+	if err := l.batch.Run(nil); err != nil {
+		return err
+	}
+
+	var measureErr error
+	if l.rowHeight <= 0 && len(l.rows) > 0 {
+		width := int(view.Right - view.Left)
+		h, err := l.rows[0].IntrinsicHeight(width)
+		if err == nil && h > 0 {
+			l.rowHeight = h
+			// the window was sized with a guess
+			return l.Refresh()
+		}
+		if measureErr = err; measureErr == nil {
+			measureErr = errVirtualRowHeight
+		}
+	}
+	if l.rowHeight > 0 {
+		l.batch.SetStyle(l.top, "height", strconv.Itoa(first*l.rowHeight)+"px")
+		l.batch.SetStyle(l.bottom, "height", strconv.Itoa((total-first-count)*l.rowHeight)+"px")
+	}
+	if err := l.batch.Run(l.container); err != nil {
+		return err
+	}
+	return measureErr
+}
+
+// virtualWindow returns the rows to show for a scroll position and view height.
+// A rowHeight of 0 (unknown) sizes the window for a single row to be measured.
+func virtualWindow(posY, viewHeight, rowHeight, overscan, total int) (first, count int) {
+	if rowHeight <= 0 {
+		// one row is enough to measure
+		rowHeight = viewHeight
+	}
+	if rowHeight <= 0 {
+		rowHeight = 1
+	}
+	first = posY / rowHeight
+	count = viewHeight/rowHeight + 1 + overscan
+	if first > total {
+		first = total
+	}
+	if first+count > total {
+		count = total - first
+	}
+	return first, count
+}
+
+// layout records in l.batch the moves that turn the window into rows
+// first..first+count and the renders of the rows that changed
+func (l *VirtualList) layout(first, count int) error {
+	// rows scrolled out on one side are moved to the other one, so that
+	// only the rows that came into view need to be rendered again
+	if d := first - l.first; d != 0 && d > -len(l.rows) && d < len(l.rows) {
+		n := len(l.rows)
+		if d > 0 {
+			for _, row := range l.rows[:d] {
+				l.batch.Detach(row)
+				l.batch.Insert(l.container, row, n)
+			}
+			rotateRows(l.rows, l.rowIndex, d)
+		} else {
+			for i := n - 1; i >= n+d; i-- {
+				l.batch.Detach(l.rows[i])
+				l.batch.Insert(l.container, l.rows[i], 1)
+			}
+			rotateRows(l.rows, l.rowIndex, n+d)
+		}
+	}
+	l.first = first
+
+	// grow or shrink the window, rows live between the two spacers
+	for len(l.rows) < count {
+		row, err := l.takeRow()
+		if err != nil {
+			return err
+		}
+		l.batch.Insert(l.container, row, len(l.rows)+1)
+		l.rows = append(l.rows, row)
+		l.rowIndex = append(l.rowIndex, -1)
+	}
+	for len(l.rows) > count {
+		n := len(l.rows) - 1
+		l.batch.Detach(l.rows[n])
+		l.pool = append(l.pool, l.rows[n])
+		l.rows[n] = nil
+		l.rows = l.rows[:n]
+		l.rowIndex = l.rowIndex[:n]
+	}
+
+	for i, row := range l.rows {
+		if l.rowIndex[i] != first+i {
+			l.source.Render(l.batch, row, first+i)
+			l.rowIndex[i] = first + i
+		}
+	}
+	return nil
+}
+
+// rotateRows rotates rows and their indices left by d
+func rotateRows(rows []*Element, index []int, d int) {
+	reverse := func(i, j int) {
+		for ; i < j; i, j = i+1, j-1 {
+			rows[i], rows[j] = rows[j], rows[i]
+			index[i], index[j] = index[j], index[i]
+		}
+	}
+	n := len(rows)
+	reverse(0, d-1)
+	reverse(d, n-1)
+	reverse(0, n-1)
+}
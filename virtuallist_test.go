@@ -0,0 +1,188 @@
+package sciter
+
+import (
+	"errors"
+	"fmt"
+	"testing"
+)
+
+type testVirtualSource struct {
+	total    int
+	rendered int
+}
+
+func (s *testVirtualSource) Len() int {
+	return s.total
+}
+
+func (s *testVirtualSource) Render(batch *DOMBatch, row *Element, index int) {
+	s.rendered++
+	batch.SetText(row, "row")
+}
+
+// newTestVirtualList returns a list that never reaches the engine as long as
+// the window stays within the pool size and the batch is not run
+func newTestVirtualList(source VirtualListSource, pool int) *VirtualList {
+	l := &VirtualList{
+		container: fakeElement(0),
+		source:    source,
+		batch:     NewDOMBatch(),
+	}
+	for i := 0; i < pool; i++ {
+		l.pool = append(l.pool, fakeElement(1+i))
+	}
+	return l
+}
+
+func checkWindow(t *testing.T, l *VirtualList, first, count int) {
+	t.Helper()
+	if l.first != first || len(l.rows) != count {
+		t.Fatalf("window %d+%d, want %d+%d", l.first, len(l.rows), first, count)
+	}
+	for i, index := range l.rowIndex {
+		if index != first+i {
+			t.Fatalf("row %d shows %d, want %d", i, index, first+i)
+		}
+	}
+}
+
+func TestRotateRows(t *testing.T) {
+	for _, d := range []int{1, 3, 4} {
+		rows := make([]*Element, 5)
+		index := make([]int, 5)
+		for i := range rows {
+			rows[i] = fakeElement(i)
+			index[i] = i
+		}
+		rotateRows(rows, index, d)
+		for i := range rows {
+			want := (i + d) % 5
+			if index[i] != want || rows[i].handle != fakeElement(want).handle {
+				t.Errorf("d=%d: slot %d holds %d, want %d", d, i, index[i], want)
+			}
+		}
+	}
+}
+
+func TestVirtualListScroll(t *testing.T) {
+	src := &testVirtualSource{total: 100}
+	l := newTestVirtualList(src, 10)
+	if err := l.layout(0, 10); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 0, 10)
+	rows := append([]*Element(nil), l.rows...)
+
+	// down by 3: the top 3 rows move to the bottom, only they are rendered
+	src.rendered = 0
+	if err := l.layout(3, 10); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 3, 10)
+	if src.rendered != 3 {
+		t.Errorf("scrolling down rendered %d rows, want 3", src.rendered)
+	}
+	if l.rows[0] != rows[3] || l.rows[9] != rows[2] {
+		t.Errorf("rows were not rotated up")
+	}
+
+	// back up by 2: the bottom 2 rows move to the top
+	src.rendered = 0
+	if err := l.layout(1, 10); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 1, 10)
+	if src.rendered != 2 {
+		t.Errorf("scrolling up rendered %d rows, want 2", src.rendered)
+	}
+	if l.rows[0] != rows[1] || l.rows[2] != rows[3] {
+		t.Errorf("rows were not rotated down")
+	}
+
+	// a jump past the window renders everything
+	src.rendered = 0
+	if err := l.layout(50, 10); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 50, 10)
+	if src.rendered != 10 {
+		t.Errorf("jumping rendered %d rows, want 10", src.rendered)
+	}
+}
+
+func TestVirtualListShrink(t *testing.T) {
+	src := &testVirtualSource{total: 100}
+	l := newTestVirtualList(src, 10)
+	// 20px rows in a 150px view: 8 rows plus overscan 2
+	first, count := virtualWindow(90*20, 150, 20, 2, src.total)
+	if first != 90 || count != 10 {
+		t.Fatalf("window %d+%d, want 90+10", first, count)
+	}
+	if err := l.layout(first, count); err != nil {
+		t.Fatal(err)
+	}
+
+	// the dataset shrinks under the window
+	src.total = 95
+	first, count = virtualWindow(90*20, 150, 20, 2, src.total)
+	if first != 90 || count != 5 {
+		t.Fatalf("window %d+%d, want 90+5", first, count)
+	}
+	if err := l.layout(first, count); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 90, 5)
+	if len(l.pool) != 5 {
+		t.Errorf("%d rows pooled, want 5", len(l.pool))
+	}
+
+	// and then below the scroll position
+	src.total = 40
+	first, count = virtualWindow(90*20, 150, 20, 2, src.total)
+	if first != 40 || count != 0 {
+		t.Fatalf("window %d+%d, want 40+0", first, count)
+	}
+	if err := l.layout(first, count); err != nil {
+		t.Fatal(err)
+	}
+	checkWindow(t, l, 40, 0)
+	if len(l.pool) != 10 {
+		t.Errorf("%d rows pooled, want 10", len(l.pool))
+	}
+}
+
+func TestVirtualListReport(t *testing.T) {
+	l := newTestVirtualList(&testVirtualSource{}, 0)
+	l.report(errors.New("dropped"))
+	var got error
+	l.OnError = func(err error) {
+		got = err
+	}
+	l.report(nil)
+	if got != nil {
+		t.Errorf("nil reported as %v", got)
+	}
+	l.report(errVirtualRowHeight)
+	if got != errVirtualRowHeight {
+		t.Errorf("reported %v, want %v", got, errVirtualRowHeight)
+	}
+}
+
+// BenchmarkVirtualListScroll scrolls by a few rows per frame, the cost must not
+// depend on the dataset size
+func BenchmarkVirtualListScroll(b *testing.B) {
+	for _, total := range []int{1e3, 1e6, 1e7} {
+		b.Run(fmt.Sprint(total), func(b *testing.B) {
+			src := &testVirtualSource{total: total}
+			l := newTestVirtualList(src, 40)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				first, count := virtualWindow(i*3*20%(total*20), 600, 20, 2, total)
+				if err := l.layout(first, count); err != nil {
+					b.Fatal(err)
+				}
+				l.batch.Reset()
+			}
+		})
+	}
+}
@@ -0,0 +1,64 @@
+package sciter
+
+import (
+	"testing"
+	"unsafe"
+)
+
+// fakeElement returns a wrapper of a handle outside of the go heap, for
+// bookkeeping that never reaches the engine
+func fakeElement(i int) *Element {
+	e := &Element{}
+	*(*uintptr)(unsafe.Pointer(&e.handle)) = 0x10000 + uintptr(i)*16
+	return e
+}
+
+func TestCheckMapperRegistersOnAttach(t *testing.T) {
+	el := fakeElement(1)
+	el.checkMapper()
+	if el.eventMapper == nil {
+		t.Fatal("no mapper")
+	}
+	if _, ok := elementMappers[el.handle]; ok {
+		t.Fatal("mapper registered before any attach")
+	}
+}
+
+// the handlers of elements that come and go, e.g. list rows
+const soakElements = 64
+
+func soakRound(round int) {
+	handler := &EventHandler{}
+	tags := make([]uintptr, soakElements)
+	for i := range tags {
+		el := fakeElement(round*soakElements + i)
+		tags[i], _ = trackElementHandler(el.handle, handler)
+	}
+	// the engine reports BEHAVIOR_DETACH as the elements are destroyed
+	for i, tag := range tags {
+		el := fakeElement(round*soakElements + i)
+		forgetElementHandler(el.handle, handler, tag)
+	}
+}
+
+func TestElementHandlerSoak(t *testing.T) {
+	soakRound(0)
+	slots := len(eventHandlers.slots)
+	for round := 1; round < 100; round++ {
+		soakRound(round)
+	}
+	if len(elementHandlers) != 0 {
+		t.Errorf("%d elements still tracked", len(elementHandlers))
+	}
+	if n := len(eventHandlers.slots); n != slots {
+		t.Errorf("handler table grew from %d to %d slots", slots, n)
+	}
+}
+
+func BenchmarkElementHandlerSoak(b *testing.B) {
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		soakRound(i)
+	}
+	b.Logf("%d elements tracked, %d handler slots", len(elementHandlers), len(eventHandlers.slots))
+}